@@ -95,6 +95,33 @@ typedef enum {
  */
 typedef SchedulerState_t xSchedulerState;
 
+/**
+ * @brief Enumerated data type for task wait conditions.
+ *
+ * A task placed in the waiting state by xTaskWaitOn() waits on one of the conditions defined
+ * by the TaskWaitCondition_t enumerated data type. TaskWaitCondition_t should be declared
+ * (i.e., used) as xTaskWaitCondition.
+ *
+ * @sa xTaskWaitCondition
+ * @sa xTaskWaitOn()
+ *
+ */
+typedef enum {
+  TaskWaitConditionNone,           /**< The task is not waiting on an object. */
+  TaskWaitConditionQueueNotEmpty,  /**< The task is executed while the queue has a message waiting. */
+  TaskWaitConditionStreamBytes,    /**< The task is executed while the stream has at least the requested number of bytes waiting. */
+  TaskWaitConditionTimerExpired,   /**< The task is executed while the timer has expired. */
+  TaskWaitConditionDeviceAvailable /**< The task is executed while the device is available. */
+} TaskWaitCondition_t;
+
+/**
+ * @brief Enumerated data type for task wait conditions.
+ *
+ * @sa TaskWaitCondition_t
+ *
+ */
+typedef TaskWaitCondition_t xTaskWaitCondition;
+
 /* START OF BASIC TYPES */
 
 /**
@@ -123,6 +150,28 @@ typedef VOID_TYPE TaskParm_t;
  */
 typedef TaskParm_t *xTaskParm;
 
+/**
+ * @brief Data type for the timer paramater.
+ *
+ * The TimerParm_t type is used to pass a paramater to the callback of a timer created
+ * by xTimerCreateCallback(). Like TaskParm_t, a timer paramater is a pointer of type void
+ * and it is up to the end-user to manage the memory it points to. TimerParm_t should be
+ * declared as xTimerParm.
+ *
+ * @sa xTimerParm
+ * @sa xTimerCreateCallback()
+ *
+ */
+typedef VOID_TYPE TimerParm_t;
+
+/**
+ * @brief Data type for the timer paramater.
+ *
+ * @sa TimerParm_t
+ *
+ */
+typedef TimerParm_t *xTimerParm;
+
 /**
  * @brief Data type for the base type.
  *
@@ -362,6 +411,83 @@ typedef VOID_TYPE StreamBuffer_t;
  */
 typedef StreamBuffer_t *xStreamBuffer;
 
+/**
+ * @brief Data type for a message buffer handle.
+ *
+ * The MessageBuffer_t data type is used as a message buffer handle. The message buffer
+ * handle is created when xMessageBufferCreate() is called. For more information about
+ * message buffers, see xMessageBufferCreate(). MessageBuffer_t should be declared as
+ * xMessageBuffer.
+ *
+ * @sa xMessageBuffer
+ * @sa xMessageBufferCreate()
+ * @attention The memory referenced by the message buffer handle must be freed by calling xMessageBufferDelete().
+ * @sa xMessageBufferDelete()
+ *
+ */
+typedef VOID_TYPE MessageBuffer_t;
+
+/**
+ * @brief Data type for a message buffer handle.
+ *
+ * @sa MessageBuffer_t
+ * @attention The memory referenced by the message buffer handle must be freed by calling xMessageBufferDelete().
+ * @sa xMessageBufferDelete()
+ *
+ */
+typedef MessageBuffer_t *xMessageBuffer;
+
+/**
+ * @brief Data type for a pipe handle.
+ *
+ * The Pipe_t data type is used as a pipe handle. The pipe handle is created when
+ * xPipeCreate() is called. For more information about pipes, see xPipeCreate().
+ * Pipe_t should be declared as xPipe.
+ *
+ * @sa xPipe
+ * @sa xPipeCreate()
+ * @attention The memory referenced by the pipe handle must be freed by calling xPipeDelete().
+ * @sa xPipeDelete()
+ *
+ */
+typedef VOID_TYPE Pipe_t;
+
+/**
+ * @brief Data type for a pipe handle.
+ *
+ * @sa Pipe_t
+ * @attention The memory referenced by the pipe handle must be freed by calling xPipeDelete().
+ * @sa xPipeDelete()
+ *
+ */
+typedef Pipe_t *xPipe;
+
+/**
+ * @brief Data type for a broadcast stream handle.
+ *
+ * The BroadcastStream_t data type is used as a broadcast stream handle. The broadcast stream
+ * handle is created when xBroadcastStreamCreate() is called. For more information about
+ * broadcast streams, see xBroadcastStreamCreate(). BroadcastStream_t should be declared as
+ * xBroadcastStream.
+ *
+ * @sa xBroadcastStream
+ * @sa xBroadcastStreamCreate()
+ * @attention The memory referenced by the broadcast stream handle must be freed by calling xBroadcastStreamDelete().
+ * @sa xBroadcastStreamDelete()
+ *
+ */
+typedef VOID_TYPE BroadcastStream_t;
+
+/**
+ * @brief Data type for a broadcast stream handle.
+ *
+ * @sa BroadcastStream_t
+ * @attention The memory referenced by the broadcast stream handle must be freed by calling xBroadcastStreamDelete().
+ * @sa xBroadcastStreamDelete()
+ *
+ */
+typedef BroadcastStream_t *xBroadcastStream;
+
 /**
  * @brief Data type for a queue handle.
  *
@@ -387,6 +513,81 @@ typedef VOID_TYPE Queue_t;
  */
 typedef Queue_t *xQueue;
 
+/**
+ * @brief Data type for a queue set.
+ *
+ * The QueueSet_t data type is used as a queue set handle. The queue set handle is created
+ * when xQueueSetCreate() is called. For more information about queue sets, see
+ * xQueueSetCreate(). QueueSet_t should be declared as xQueueSet.
+ *
+ * @sa xQueueSet
+ * @sa xQueueSetCreate()
+ * @attention The memory referenced by the queue set handle must be freed by calling xQueueSetDelete().
+ * @sa xQueueSetDelete()
+ *
+ */
+typedef VOID_TYPE QueueSet_t;
+
+/**
+ * @brief Data type for a queue set handle.
+ *
+ * @sa QueueSet_t
+ * @attention The memory referenced by the queue set handle must be freed by calling xQueueSetDelete().
+ * @sa xQueueSetDelete()
+ *
+ */
+typedef QueueSet_t *xQueueSet;
+
+/**
+ * @brief Data type for a topic.
+ *
+ * The Topic_t data type is used as a topic handle. The topic handle is created when
+ * xTopicCreate() is called. For more information about topics, see xTopicCreate().
+ * Topic_t should be declared as xTopic.
+ *
+ * @sa xTopic
+ * @sa xTopicCreate()
+ * @attention The memory referenced by the topic handle must be freed by calling xTopicDelete().
+ * @sa xTopicDelete()
+ *
+ */
+typedef VOID_TYPE Topic_t;
+
+/**
+ * @brief Data type for a topic handle.
+ *
+ * @sa Topic_t
+ * @attention The memory referenced by the topic handle must be freed by calling xTopicDelete().
+ * @sa xTopicDelete()
+ *
+ */
+typedef Topic_t *xTopic;
+
+/**
+ * @brief Data type for a single-producer, single-consumer queue.
+ *
+ * The SPSCQueue_t data type is used as a single-producer, single-consumer queue handle. The
+ * handle is created when xSPSCQueueCreate() is called. SPSCQueue_t should be declared as
+ * xSPSCQueue.
+ *
+ * @sa xSPSCQueue
+ * @sa xSPSCQueueCreate()
+ * @attention The memory referenced by the queue handle must be freed by calling xSPSCQueueDelete().
+ * @sa xSPSCQueueDelete()
+ *
+ */
+typedef VOID_TYPE SPSCQueue_t;
+
+/**
+ * @brief Data type for a single-producer, single-consumer queue handle.
+ *
+ * @sa SPSCQueue_t
+ * @attention The memory referenced by the queue handle must be freed by calling xSPSCQueueDelete().
+ * @sa xSPSCQueueDelete()
+ *
+ */
+typedef SPSCQueue_t *xSPSCQueue;
+
 /**
  * @brief Data type for a timer handle.
  *
@@ -412,6 +613,32 @@ typedef VOID_TYPE Timer_t;
  */
 typedef Timer_t *xTimer;
 
+/**
+ * @brief Data type for a movable memory handle.
+ *
+ * The MemoryHandle_t data type is used as a handle to movable heap memory. The memory handle is
+ * created when xMemHandleAlloc() is called. Because the memory behind the handle may be moved by
+ * heap compaction, it must be locked with xMemHandleLock() before it is accessed. MemoryHandle_t
+ * should be declared as xMemoryHandle.
+ *
+ * @sa xMemoryHandle
+ * @sa xMemHandleAlloc()
+ * @attention The memory referenced by the memory handle must be freed by calling xMemHandleFree().
+ * @sa xMemHandleFree()
+ *
+ */
+typedef VOID_TYPE MemoryHandle_t;
+
+/**
+ * @brief Data type for a movable memory handle.
+ *
+ * @sa MemoryHandle_t
+ * @attention The memory referenced by the memory handle must be freed by calling xMemHandleFree().
+ * @sa xMemHandleFree()
+ *
+ */
+typedef MemoryHandle_t *xMemoryHandle;
+
 /* START OF STRUCT TYPES */
 
 /**
@@ -485,8 +712,10 @@ typedef TaskRunTimeStats_t *xTaskRunTimeStats;
  * @brief Data structure for memory region statistics.
  *
  * The MemoryRegionStats_t data structure is used by xMemGetHeapStats() and xMemGetKernelStats()
- * to obtain statistics about either memory region. The MemoryRegionStats_t type should be declared
- * as xMemoryRegionStats.
+ * to obtain statistics about either memory region. The fragmentation metrics, histograms and
+ * byte counts are maintained as memory is allocated and freed so they can be used to predict
+ * allocation failures and tune CONFIG_MEMORY_REGION_BLOCK_SIZE. The MemoryRegionStats_t type
+ * should be declared as xMemoryRegionStats.
  *
  * @sa xMemoryRegionStats
  * @sa xMemGetHeapStats()
@@ -496,13 +725,18 @@ typedef TaskRunTimeStats_t *xTaskRunTimeStats;
  *
  */
 typedef struct MemoryRegionStats_s {
-  Word_t largestFreeEntryInBytes;       /**< The largest free entry in bytes. */
-  Word_t smallestFreeEntryInBytes;      /**< The smallest free entry in bytes. */
-  Word_t numberOfFreeBlocks;            /**< The number of free blocks - see CONFIG_MEMORY_REGION_BLOCK_SIZE for block size in bytes. */
-  Word_t availableSpaceInBytes;         /**< The amount of free memory in bytes (i.e., numberOfFreeBlocks * CONFIG_MEMORY_REGION_BLOCK_SIZE). */
-  Word_t successfulAllocations;         /**< Number of successful memory allocations. */
-  Word_t successfulFrees;               /**< Number of successful memory "frees". */
-  Word_t minimumEverFreeBytesRemaining; /**< Lowest water lever since system initialization of free bytes of memory. */
+  Word_t largestFreeEntryInBytes;                                     /**< The largest free entry in bytes. */
+  Word_t smallestFreeEntryInBytes;                                    /**< The smallest free entry in bytes. */
+  Word_t numberOfFreeBlocks;                                          /**< The number of free blocks - see CONFIG_MEMORY_REGION_BLOCK_SIZE for block size in bytes. */
+  Word_t availableSpaceInBytes;                                       /**< The amount of free memory in bytes (i.e., numberOfFreeBlocks * CONFIG_MEMORY_REGION_BLOCK_SIZE). */
+  Word_t successfulAllocations;                                       /**< Number of successful memory allocations. */
+  Word_t successfulFrees;                                             /**< Number of successful memory "frees". */
+  Word_t minimumEverFreeBytesRemaining;                               /**< Lowest water lever since system initialization of free bytes of memory. */
+  Word_t externalFragmentationPercent;                                /**< The percentage of free memory that is not part of the largest free entry - zero means all free memory is contiguous. */
+  Word_t requestedBytesInUse;                                         /**< The number of bytes requested by allocations that have not yet been freed. */
+  Word_t grantedBytesInUse;                                           /**< The number of bytes granted to allocations that have not yet been freed - the difference from requestedBytesInUse is the internal fragmentation. */
+  Word_t freeEntryHistogram[MEMORY_REGION_HISTOGRAM_BUCKETS];         /**< The number of free entries by size where element n counts the free entries of 2^n to 2^(n+1)-1 blocks. */
+  Word_t sizeClassAllocations[MEMORY_REGION_HISTOGRAM_BUCKETS];       /**< The number of successful allocations by size class where element n counts allocations of 2^n to 2^(n+1)-1 blocks (including the entry). */
 } MemoryRegionStats_t;
 
 /**
@@ -515,6 +749,72 @@ typedef struct MemoryRegionStats_s {
  */
 typedef MemoryRegionStats_t *xMemoryRegionStats;
 
+/**
+ * @brief Data structure for message queue statistics.
+ *
+ * The QueueStats_t data structure is used by xQueueGetStats() to obtain statistics about a
+ * message queue. The statistics are only kept if CONFIG_ENABLE_QUEUE_STATS is defined. Comparing
+ * the statistics of the queues in a pipeline shows which queue is the bottleneck. The QueueStats_t
+ * type should be declared as xQueueStats.
+ *
+ * @sa xQueueStats
+ * @sa xQueueGetStats()
+ * @sa CONFIG_ENABLE_QUEUE_STATS
+ * @attention The memory allocated for the data struture must be freed by calling xMemFree().
+ * @sa xMemFree()
+ *
+ */
+typedef struct QueueStats_s {
+  Word_t enqueued;                                           /**< The number of messages sent to the queue. */
+  Word_t dequeued;                                           /**< The number of messages received or dropped from the queue. */
+  Word_t rejectedFull;                                       /**< The number of messages that could not be sent because the queue was full. */
+  Word_t overwritten;                                        /**< The number of messages a mailbox overwrote before they were received. */
+  Base_t highWater;                                          /**< The highest number of messages the queue has held. */
+  Ticks_t minimumLatency;                                    /**< The shortest time in ticks a message waited in the queue. */
+  Ticks_t maximumLatency;                                    /**< The longest time in ticks a message waited in the queue. */
+  Ticks_t averageLatency;                                    /**< The average time in ticks a message waited in the queue. */
+  Word_t latencyHistogram[QUEUE_LATENCY_HISTOGRAM_BUCKETS];  /**< The number of messages by time waited where element n counts messages that waited 2^n to 2^(n+1)-1 ticks. */
+} QueueStats_t;
+
+/**
+ * @brief Data structure for message queue statistics.
+ *
+ * @sa QueueStats_t
+ * @attention The memory allocated for the data struture must be freed by calling xMemFree().
+ * @sa xMemFree()
+ *
+ */
+typedef QueueStats_t *xQueueStats;
+
+/**
+ * @brief Data structure for a topic message.
+ *
+ * The TopicMessage_t data structure is returned by xTopicReceive() and holds a message published
+ * to a topic. Every subscriber receives the same message, so the message must not be changed.
+ * The TopicMessage_t type should be declared as xTopicMessage.
+ *
+ * @sa xTopicMessage
+ * @sa xTopicReceive()
+ * @attention The message must be released by calling xTopicRelease().
+ * @sa xTopicRelease()
+ *
+ */
+typedef struct TopicMessage_s {
+  HalfWord_t references;  /**< The number of references to the message that have not been released. */
+  Size_t messageBytes;    /**< The number of bytes contained in the message value. */
+  Byte_t *messageValue;   /**< The message value. */
+} TopicMessage_t;
+
+/**
+ * @brief Data structure for a topic message.
+ *
+ * @sa TopicMessage_t
+ * @attention The message must be released by calling xTopicRelease().
+ * @sa xTopicRelease()
+ *
+ */
+typedef TopicMessage_t *xTopicMessage;
+
 /**
  * @brief Data structure for information about a task
  *
@@ -861,11 +1161,134 @@ xMemoryRegionStats xMemGetHeapStats(void);
  */
 xMemoryRegionStats xMemGetKernelStats(void);
 
+/**
+ * @brief System call to set the low-water threshold for the heap.
+ *
+ * The xMemSetHeapWatermark() system call sets a low-water threshold for the heap. When
+ * an allocation leaves fewer free bytes in the heap than the threshold, the callback is
+ * called and/or the task is sent a direct to task notification whose one byte value is
+ * MEMORY_WATERMARK_HEAP_NOTIFICATION. This happens once when the threshold is crossed and
+ * is re-armed when memory is freed back above the threshold. This gives the application a
+ * chance to shed memory (e.g., caches or trace buffers) before xMemAlloc() fails. The check
+ * is made against a maintained free block count so it adds a constant cost to each allocation.
+ *
+ * @sa xMemSetKernelWatermark()
+ * @sa xTaskNotifyGive()
+ *
+ * @param bytes_ The low-water threshold in bytes. A threshold of zero disables the watermark.
+ * @param callback_ The callback to call when the threshold is crossed, the callback is passed the
+ * number of free bytes remaining. The callback may be null if a task is specified.
+ * @param task_ The task to notify when the threshold is crossed. The task may be null if a callback
+ * is specified.
+ * @return xBase RETURN_SUCCESS if the watermark was set, otherwise RETURN_FAILURE if there is
+ * nothing to call or notify or the task is not a valid task.
+ *
+ * @note The callback is called from within the system call that allocated the memory so it should
+ * be kept short. If the task already has a notification waiting, the watermark notification is dropped.
+ */
+xBase xMemSetHeapWatermark(const xSize bytes_, void (*callback_)(const xSize available_), xTask task_);
+
+/**
+ * @brief System call to set the low-water threshold for the kernel memory region.
+ *
+ * The xMemSetKernelWatermark() system call sets a low-water threshold for the kernel memory
+ * region. It behaves like xMemSetHeapWatermark() except that it watches the memory used by
+ * kernel objects (e.g., tasks, queues and timers) and the task notification value is
+ * MEMORY_WATERMARK_KERNEL_NOTIFICATION.
+ *
+ * @sa xMemSetHeapWatermark()
+ *
+ * @param bytes_ The low-water threshold in bytes. A threshold of zero disables the watermark.
+ * @param callback_ The callback to call when the threshold is crossed, the callback is passed the
+ * number of free bytes remaining. The callback may be null if a task is specified.
+ * @param task_ The task to notify when the threshold is crossed. The task may be null if a callback
+ * is specified.
+ * @return xBase RETURN_SUCCESS if the watermark was set, otherwise RETURN_FAILURE if there is
+ * nothing to call or notify or the task is not a valid task.
+ */
+xBase xMemSetKernelWatermark(const xSize bytes_, void (*callback_)(const xSize available_), xTask task_);
+
+/**
+ * @brief System call to allocate movable memory from the heap.
+ *
+ * The xMemHandleAlloc() system call allocates memory from the heap and returns a handle
+ * to it rather than an address. Because the application only holds the handle, the kernel
+ * is free to slide the memory toward the start of the heap to close holes left by freed
+ * memory. If the heap does not have a free entry large enough to satisfy the request,
+ * xMemHandleAlloc() compacts the heap before trying the allocation. The memory is cleared
+ * to zero.
+ *
+ * @sa xMemoryHandle
+ * @sa xMemHandleLock()
+ * @sa xMemHandleFree()
+ * @sa xMemCompact()
+ *
+ * @param size_ The amount of memory to allocate in bytes.
+ * @return xMemoryHandle Returns a handle to the memory or null if unsuccessful.
+ *
+ * @warning The memory allocated by xMemHandleAlloc() must be freed by xMemHandleFree().
+ */
+xMemoryHandle xMemHandleAlloc(const xSize size_);
+
+/**
+ * @brief System call to free movable memory.
+ *
+ * The xMemHandleFree() system call frees the memory and the handle allocated by
+ * xMemHandleAlloc(). The handle must not be used after it is freed.
+ *
+ * @sa xMemHandleAlloc()
+ *
+ * @param handle_ The handle to free.
+ */
+void xMemHandleFree(xMemoryHandle handle_);
+
+/**
+ * @brief System call to lock movable memory and obtain its address.
+ *
+ * The xMemHandleLock() system call returns the current address of the memory behind the
+ * handle and pins it in place until it is unlocked. Locks nest, so each call to
+ * xMemHandleLock() must be paired with a call to xMemHandleUnlock(). The address must not
+ * be used once the handle is unlocked because the memory may be moved.
+ *
+ * @sa xMemHandleUnlock()
+ *
+ * @param handle_ The handle to lock.
+ * @return xAddr Returns the address of the memory or null if unsuccessful.
+ */
+xAddr xMemHandleLock(xMemoryHandle handle_);
+
+/**
+ * @brief System call to unlock movable memory.
+ *
+ * The xMemHandleUnlock() system call releases a lock taken by xMemHandleLock(). When the
+ * last lock is released the memory may again be moved by heap compaction.
+ *
+ * @sa xMemHandleLock()
+ *
+ * @param handle_ The handle to unlock.
+ */
+void xMemHandleUnlock(xMemoryHandle handle_);
+
+/**
+ * @brief System call to compact the heap.
+ *
+ * The xMemCompact() system call slides unlocked movable memory toward the start of the
+ * heap until no more can be moved, merging the free holes behind it into one free entry.
+ * The scheduler also performs one compaction step on each pass in which no task was run,
+ * so xMemCompact() is only needed when the application requires a large contiguous
+ * allocation right away. Memory allocated with xMemAlloc() is never moved.
+ *
+ * @sa xMemHandleAlloc()
+ */
+void xMemCompact(void);
+
 /**
  * @brief System call to create a new message queue.
  *
  * The xQueueCreate() system call creates a message queue for inter-task
- * communication.
+ * communication. The storage for all of the queue's messages is allocated from
+ * kernel memory when the queue is created, so sending and receiving messages does
+ * not allocate kernel memory.
  *
  * @sa xQueue
  * @sa xQueueDelete()
@@ -880,6 +1303,108 @@ xMemoryRegionStats xMemGetKernelStats(void);
  */
 xQueue xQueueCreate(const xBase limit_);
 
+/**
+ * @brief System call to create a new message queue with a specified message size.
+ *
+ * The xQueueCreateEx() system call creates a message queue like xQueueCreate() except
+ * that the largest message value the queue can hold is specified when the queue is
+ * created rather than by the CONFIG_MESSAGE_VALUE_BYTES setting. This allows a queue of
+ * small messages to stay small and a queue of large records (e.g., a 64 byte sensor frame)
+ * to send each record as one message. Every message occupies the same amount of the queue's
+ * storage regardless of its size.
+ *
+ * @sa xQueueCreate()
+ * @sa xQueueCreateVariable()
+ * @sa xQueueReceiveBytes()
+ * @sa xQueueDelete()
+ *
+ * @param limit_ The message limit for the queue. The minimum limit for queues is dependent
+ * on the setting CONFIG_QUEUE_MINIMUM_LIMIT.
+ * @param messageBytes_ The largest message value, in bytes, the queue can hold. Must be
+ * greater than zero.
+ * @return xQueue A queue is returned if successful, otherwise null is returned if unsuccessful.
+ *
+ * @note Messages larger than CONFIG_MESSAGE_VALUE_BYTES cannot be returned by xQueuePeek() or
+ * xQueueReceive() and must be received with xQueueReceiveBytes().
+ *
+ * @warning The message queue memory can only be freed by xQueueDelete().
+ */
+xQueue xQueueCreateEx(const xBase limit_, const xBase messageBytes_);
+
+/**
+ * @brief System call to create a new message queue for variable length messages.
+ *
+ * The xQueueCreateVariable() system call creates a message queue whose storage is a ring
+ * of the specified number of bytes. Each message only occupies a small header plus its
+ * message value, so a mix of small and large messages packs densely. A message is accepted
+ * by xQueueSend() as long as the queue is below its limit and the ring has room for the
+ * whole message.
+ *
+ * @sa xQueueCreate()
+ * @sa xQueueCreateEx()
+ * @sa xQueueReceiveBytes()
+ * @sa xQueueDelete()
+ *
+ * @param limit_ The message limit for the queue. The minimum limit for queues is dependent
+ * on the setting CONFIG_QUEUE_MINIMUM_LIMIT.
+ * @param bytes_ The size of the ring in bytes.
+ * @return xQueue A queue is returned if successful, otherwise null is returned if unsuccessful.
+ *
+ * @note Messages are never split across the end of the ring, so the space between the last
+ * message and the end of the ring may go unused until the ring wraps.
+ *
+ * @warning The message queue memory can only be freed by xQueueDelete().
+ */
+xQueue xQueueCreateVariable(const xBase limit_, const xSize bytes_);
+
+/**
+ * @brief System call to create a new priority message queue.
+ *
+ * The xQueueCreatePriority() system call creates a message queue where each message carries a
+ * priority from zero (lowest) to QUEUE_PRIORITY_LEVELS - 1 (highest). Receiving from the queue
+ * always returns the oldest message of the highest priority, so an urgent message does not wait
+ * behind less important ones. Messages of each priority are kept in their own FIFO and the
+ * non-empty priorities are tracked in a bitmap, so sending and receiving take constant time
+ * regardless of how many messages are waiting. All of the other message queue system calls work
+ * with priority queues. Messages sent with xQueueSend() or xQueueSendBatch() have priority zero.
+ *
+ * @sa xQueueSendPriority()
+ * @sa xQueueDelete()
+ * @sa QUEUE_PRIORITY_LEVELS
+ *
+ * @param limit_ The message limit for the queue. The minimum limit for queues is dependent on the
+ * setting CONFIG_QUEUE_MINIMUM_LIMIT and the limit must be less than QUEUE_SLOT_NONE.
+ * @param messageBytes_ The largest message value, in bytes, the queue can hold. Must be greater
+ * than zero.
+ * @return xQueue A queue is returned if successful, otherwise null is returned if unsuccessful.
+ *
+ * @warning The message queue memory can only be freed by xQueueDelete().
+ */
+xQueue xQueueCreatePriority(const xBase limit_, const xBase messageBytes_);
+
+/**
+ * @brief System call to create a new mailbox message queue.
+ *
+ * The xQueueCreateMailbox() system call creates a message queue for state where only the newest
+ * values matter, such as the latest sensor reading. Sending to a full mailbox never fails, it
+ * overwrites the oldest message instead, so a fast producer can't leave a slow consumer with
+ * stale messages. A mailbox with a limit of one always holds just the latest message. Receive
+ * messages with xQueueReceiveSequence() to find out how many were overwritten. All of the other
+ * message queue system calls work with mailboxes.
+ *
+ * @sa xQueueReceiveSequence()
+ * @sa xQueueDelete()
+ *
+ * @param limit_ The number of messages the mailbox keeps. Unlike other message queues, a mailbox
+ * may have a limit as low as one.
+ * @param messageBytes_ The largest message value, in bytes, the mailbox can hold. Must be greater
+ * than zero.
+ * @return xQueue A queue is returned if successful, otherwise null is returned if unsuccessful.
+ *
+ * @warning The message queue memory can only be freed by xQueueDelete().
+ */
+xQueue xQueueCreateMailbox(const xBase limit_, const xBase messageBytes_);
+
 /**
  * @brief System call to delete a message queue.
  *
@@ -948,7 +1473,8 @@ xBase xQueueMessagesWaiting(const xQueue queue_);
  *
  * The xQueueSend() system call will send a message using the specified message queue. The size of the message
  * value is passed in the message bytes parameter. The maximum message value size in bytes is dependent
- * on the CONFIG_MESSAGE_VALUE_BYTES setting.
+ * on the CONFIG_MESSAGE_VALUE_BYTES setting unless the queue was created by xQueueCreateEx() or
+ * xQueueCreateVariable().
  *
  * @sa CONFIG_MESSAGE_VALUE_BYTES
  * @sa xQueuePeek()
@@ -956,15 +1482,53 @@ xBase xQueueMessagesWaiting(const xQueue queue_);
  *
  * @param queue_ The queue to send the message to.
  * @param messageBytes_ The number of bytes contained in the message value. The number of bytes must be greater than
- * zero and less than or equal to the setting CONFIG_MESSAGE_VALUE_BYTES.
- * @param messageValue_ The message value. If the message value is greater than defined in CONFIG_MESSAGE_VALUE_BYTES,
- * only the number of bytes defined in CONFIG_MESSAGE_VALUE_BYTES will be copied into the message value. The message
- * value is NOT a null terminated string.
+ * zero and less than or equal to the largest message value the queue can hold.
+ * @param messageValue_ The message value. Only the number of bytes specified by the message bytes parameter are
+ * copied into the queue. The message value is NOT a null terminated string.
  * @return xBase xQueueSend() returns RETURN_SUCCESS if the message was sent to the queue successfully. Otherwise
  * RETURN_FAILURE if unsuccessful.
  */
 xBase xQueueSend(xQueue queue_, const xBase messageBytes_, const xChar *messageValue_);
 
+/**
+ * @brief System call to send a message with a priority using a message queue.
+ *
+ * The xQueueSendPriority() system call will send a message with the specified priority using the
+ * specified message queue. If the queue was not created by xQueueCreatePriority(), the priority is
+ * ignored and the message is sent like xQueueSend().
+ *
+ * @sa xQueueCreatePriority()
+ * @sa xQueueSend()
+ *
+ * @param queue_ The queue to send the message to.
+ * @param priority_ The priority of the message from zero (lowest) to QUEUE_PRIORITY_LEVELS - 1 (highest).
+ * @param messageBytes_ The number of bytes contained in the message value.
+ * @param messageValue_ The message value. The message value is NOT a null terminated string.
+ * @return xBase RETURN_SUCCESS if the message was sent to the queue successfully. Otherwise
+ * RETURN_FAILURE if unsuccessful.
+ */
+xBase xQueueSendPriority(xQueue queue_, const xBase priority_, const xBase messageBytes_, const xChar *messageValue_);
+
+/**
+ * @brief System call to send several messages using a message queue.
+ *
+ * The xQueueSendBatch() system call will send an array of messages using the specified message
+ * queue. The queue is validated once for the whole batch and the messages are copied into the
+ * queue back to back, which is cheaper than calling xQueueSend() once per message for bursty
+ * producers. In QUEUE_BATCH_ALL_OR_NOTHING mode either every message is sent or none are. In
+ * QUEUE_BATCH_BEST_EFFORT mode messages are sent in order until one does not fit.
+ *
+ * @sa xQueueSend()
+ * @sa xQueueReceiveBatch()
+ *
+ * @param queue_ The queue to send the messages to.
+ * @param count_ The number of messages in the array.
+ * @param messages_ The array of messages to send.
+ * @param mode_ Either QUEUE_BATCH_ALL_OR_NOTHING or QUEUE_BATCH_BEST_EFFORT.
+ * @return xBase The number of messages sent.
+ */
+xBase xQueueSendBatch(xQueue queue_, const xBase count_, const xQueueMessage messages_, const xBase mode_);
+
 /**
  * @brief System call to peek at the next message in a message queue.
  *
@@ -975,8 +1539,9 @@ xBase xQueueSend(xQueue queue_, const xBase messageBytes_, const xChar *messageV
  * @sa xMemFree()
  *
  * @param queue_ The queue to return the next message from.
- * @return xQueueMessage The next message in the queue. If the queue is empty or the queue
- * parameter is invalid, xQueuePeek() will return null.
+ * @return xQueueMessage The next message in the queue. If the queue is empty, the queue
+ * parameter is invalid or the message value is larger than CONFIG_MESSAGE_VALUE_BYTES,
+ * xQueuePeek() will return null.
  *
  * @warning The memory allocated by xQueuePeek() must be freed by xMemFree().
  */
@@ -1003,64 +1568,509 @@ void xQueueDropMessage(xQueue queue_);
  *
  * @param queue_ The queue to return the next message from.
  * @return xQueueMessage The message returned from the queue. If the queue is empty
- * of the queue parameter is invalid, xQueueReceive() will return null.
+ * of the queue parameter is invalid, xQueueReceive() will return null. If the message value
+ * is larger than CONFIG_MESSAGE_VALUE_BYTES, xQueueReceive() will return null and leave the
+ * message in the queue.
  *
  * @warning The memory allocated by xQueueReceive() must be freed by xMemFree().
  */
 xQueueMessage xQueueReceive(xQueue queue_);
 
 /**
- * @brief System call to LOCK the message queue.
+ * @brief System call to receive the next message in the message queue into a buffer.
  *
- * The xQueueLockQueue() system call will lock the message queue. Locking a message queue
- * will prevent xQueueSend() from sending messages to the queue.
+ * The xQueueReceiveBytes() system call will copy the value of the next message in the message
+ * queue into the end-user's buffer and drop it from the message queue. Unlike xQueueReceive(),
+ * it does not allocate heap memory and can receive messages of any size.
  *
- * @param queue_ The queue to lock.
+ * @sa xQueueCreateEx()
+ * @sa xQueueCreateVariable()
+ *
+ * @param queue_ The queue to receive the next message from.
+ * @param bufferBytes_ The size of the buffer in bytes.
+ * @param buffer_ The buffer to copy the message value into.
+ * @return xBase The number of bytes in the message value. If the queue is empty, the queue
+ * parameter is invalid or the message value is larger than the buffer, zero is returned and
+ * the message is left in the queue.
  */
-void xQueueLockQueue(xQueue queue_);
+xBase xQueueReceiveBytes(xQueue queue_, const xBase bufferBytes_, xChar *buffer_);
 
 /**
- * @brief System call to UNLOCk the message queue.
+ * @brief System call to receive the next message in the message queue into a queue message.
  *
- * The xQueueUnLockQueue() system call will unlock the message queue. Unlocking a message queue
- * will allow xQueueSend() to send messages to the queue.
+ * The xQueueReceiveInto() system call will copy the next message in the message queue into
+ * the end-user's queue message and drop it from the message queue. Unlike xQueueReceive(), it
+ * does not allocate heap memory so there is nothing to free. The queue message is typically a
+ * local variable of the task draining the queue.
  *
- * @param queue_ The queue to unlock.
+ * @sa xQueueReceive()
+ * @sa xQueuePeekRef()
+ *
+ * @param queue_ The queue to receive the next message from.
+ * @param message_ The queue message to copy the message into.
+ * @return xBase RETURN_SUCCESS if a message was received, otherwise RETURN_FAILURE if the
+ * queue is empty, the queue parameter is invalid or the message value is larger than
+ * CONFIG_MESSAGE_VALUE_BYTES.
  */
-void xQueueUnLockQueue(xQueue queue_);
+xBase xQueueReceiveInto(xQueue queue_, xQueueMessage message_);
 
 /**
- * @brief The xStreamCreate() system call will create a new stream buffer.
+ * @brief System call to receive the next message and its sequence number from a message queue.
  *
- * The xStreamCreate() system call will create a new stream buffer. The
- * memory for a stream buffer is allocated from kernel memory and therefor
- * cannot be freed by calling xMemFree().
+ * The xQueueReceiveSequence() system call receives the next message like xQueueReceiveInto() and
+ * also returns its sequence number. Messages are numbered from one in the order they are sent to
+ * the queue. If the sequence number is more than one greater than the last one received, the
+ * messages in between were overwritten by a mailbox before they could be received. Sequence
+ * numbers are not available for priority queues.
  *
- * @return xStreamBuffer The newly created stream buffer.
+ * @sa xQueueCreateMailbox()
+ * @sa xQueueReceiveInto()
  *
- * @warning The stream buffer created by xStreamCreate() must
- * be freed by calling xStreamDelete().
+ * @param queue_ The queue to receive the message from.
+ * @param message_ The queue message to copy the message into.
+ * @param sequence_ The sequence number of the message received.
+ * @return xBase RETURN_SUCCESS if a message was received, otherwise RETURN_FAILURE if the queue
+ * is empty or is a priority queue.
  */
-xStreamBuffer xStreamCreate(void);
+xBase xQueueReceiveSequence(xQueue queue_, xQueueMessage message_, xWord *sequence_);
 
 /**
- * @brief The xStreamDelete() system call will delete a stream buffer
+ * @brief System call to receive several messages from a message queue.
  *
- * The xStreamDelete() system call will delete a stream buffer and
- * free its memory. Once a stream buffer is deleted, it can not
- * be written to or read from.
+ * The xQueueReceiveBatch() system call will receive up to the specified number of messages from
+ * the message queue into the end-user's array of queue messages and drop them from the message
+ * queue. The queue is validated once for the whole batch and no heap memory is allocated.
  *
- * @param stream_ The stream buffer to operate on.
+ * @sa xQueueReceiveInto()
+ * @sa xQueueSendBatch()
+ *
+ * @param queue_ The queue to receive the messages from.
+ * @param max_ The number of queue messages in the array.
+ * @param messages_ The array of queue messages to copy the messages into.
+ * @return xBase The number of messages received. Receiving stops early if the queue becomes
+ * empty or the next message value is larger than CONFIG_MESSAGE_VALUE_BYTES.
  */
-void xStreamDelete(const xStreamBuffer stream_);
+xBase xQueueReceiveBatch(xQueue queue_, const xBase max_, xQueueMessage messages_);
+
+/**
+ * @brief System call to peek at the next message in a message queue without copying it.
+ *
+ * The xQueuePeekRef() system call will return a pointer to the value of the next message in
+ * the message queue without copying or dropping the message. The number of bytes in the message
+ * value is returned through the message bytes parameter. No heap memory is allocated.
+ *
+ * @sa xQueuePeek()
+ * @sa xQueueDropMessage()
+ *
+ * @param queue_ The queue to peek at.
+ * @param messageBytes_ The number of bytes in the message value.
+ * @return const xChar* A pointer to the message value or null if the queue is empty or the
+ * queue parameter is invalid. The message value is NOT a null terminated string.
+ *
+ * @warning The pointer refers to the message queue's own storage and is only valid until the
+ * message queue is next changed (e.g., by xQueueSend(), xQueueReceive(), xQueueDropMessage() or
+ * xQueueDelete()). The message value must not be modified.
+ */
+const xChar *xQueuePeekRef(const xQueue queue_, xBase *messageBytes_);
+
+/**
+ * @brief System call to LOCK the message queue.
+ *
+ * The xQueueLockQueue() system call will lock the message queue. Locking a message queue
+ * will prevent xQueueSend() from sending messages to the queue.
+ *
+ * @param queue_ The queue to lock.
+ */
+void xQueueLockQueue(xQueue queue_);
+
+/**
+ * @brief System call to UNLOCk the message queue.
+ *
+ * The xQueueUnLockQueue() system call will unlock the message queue. Unlocking a message queue
+ * will allow xQueueSend() to send messages to the queue.
+ *
+ * @param queue_ The queue to unlock.
+ */
+void xQueueUnLockQueue(xQueue queue_);
+
+/**
+ * @brief System call to create a queue set attached to a task.
+ *
+ * The xQueueSetCreate() system call creates a queue set attached to the specified task. Once
+ * queues are added to the set with xQueueSetAdd(), the scheduler will execute the task while it
+ * is in the waiting state and any of the queues in its set has a message waiting. Inside the
+ * task, xQueueSetSelect() returns a queue that has a message waiting. This lets a task service
+ * many queues without running continuously or on a timer to poll them. A task may have only one
+ * queue set.
+ *
+ * @sa xQueueSetAdd()
+ * @sa xQueueSetSelect()
+ * @sa xQueueSetDelete()
+ * @sa xTaskWait()
+ *
+ * @param task_ The task to attach the queue set to.
+ * @param limit_ The maximum number of queues the set can hold.
+ * @return xQueueSet A queue set is returned if successful, otherwise null is returned if unsuccessful.
+ *
+ * @warning The queue set memory can only be freed by xQueueSetDelete().
+ */
+xQueueSet xQueueSetCreate(xTask task_, const xBase limit_);
+
+/**
+ * @brief System call to delete a queue set.
+ *
+ * The xQueueSetDelete() system call will delete a queue set and detach it from its task. The
+ * queues in the set are not deleted.
+ *
+ * @sa xQueueSetCreate()
+ *
+ * @param set_ The queue set to delete.
+ */
+void xQueueSetDelete(xQueueSet set_);
+
+/**
+ * @brief System call to add a queue to a queue set.
+ *
+ * The xQueueSetAdd() system call will add a queue to a queue set. A queue may be a member of only
+ * one queue set. Deleting a queue with xQueueDelete() removes it from its queue set.
+ *
+ * @sa xQueueSetCreate()
+ * @sa xQueueSetRemove()
+ *
+ * @param set_ The queue set to add the queue to.
+ * @param queue_ The queue to add.
+ * @return xBase RETURN_SUCCESS if the queue was added to the queue set, otherwise RETURN_FAILURE
+ * if the queue set is full or the queue is already a member of a queue set.
+ */
+xBase xQueueSetAdd(xQueueSet set_, xQueue queue_);
+
+/**
+ * @brief System call to remove a queue from a queue set.
+ *
+ * The xQueueSetRemove() system call will remove a queue from a queue set.
+ *
+ * @sa xQueueSetAdd()
+ *
+ * @param set_ The queue set to remove the queue from.
+ * @param queue_ The queue to remove.
+ * @return xBase RETURN_SUCCESS if the queue was removed from the queue set, otherwise
+ * RETURN_FAILURE if the queue is not a member of the queue set.
+ */
+xBase xQueueSetRemove(xQueueSet set_, xQueue queue_);
+
+/**
+ * @brief System call to return a queue in a queue set that has a message waiting.
+ *
+ * The xQueueSetSelect() system call returns a queue in the queue set that has a message waiting.
+ * The queues are visited in round robin order so one busy queue can't starve the others. The
+ * queue set keeps a count of its queues with messages waiting, so when none do xQueueSetSelect()
+ * returns without visiting them.
+ *
+ * @sa xQueueSetCreate()
+ *
+ * @param set_ The queue set to select from.
+ * @return xQueue A queue with a message waiting, otherwise null if no queue in the set has a
+ * message waiting.
+ */
+xQueue xQueueSetSelect(xQueueSet set_);
+
+/**
+ * @brief System call to obtain the statistics for a message queue.
+ *
+ * The xQueueGetStats() system call returns the statistics for a message queue. The queue counts
+ * the messages sent, received, rejected and overwritten, tracks the highest number of messages
+ * it has held and measures how long each message waited by stamping it with the time it was
+ * sent. The statistics are only kept if CONFIG_ENABLE_QUEUE_STATS is defined.
+ *
+ * @sa xQueueStats
+ * @sa CONFIG_ENABLE_QUEUE_STATS
+ * @sa xMemFree()
+ *
+ * @param queue_ The queue to obtain the statistics for.
+ * @return xQueueStats The statistics for the queue, otherwise null if unsuccessful or if
+ * CONFIG_ENABLE_QUEUE_STATS is not defined.
+ *
+ * @warning The memory allocated by xQueueGetStats() must be freed by xMemFree().
+ */
+xQueueStats xQueueGetStats(const xQueue queue_);
+
+/**
+ * @brief System call to create a topic.
+ *
+ * The xTopicCreate() system call creates a topic that queues can subscribe to with
+ * xTopicSubscribe(). A message published to the topic with xTopicPublish() is copied once into
+ * a reference counted message and only a reference to it is sent to each subscriber. This keeps
+ * the cost of fan-out from growing with the size of the message.
+ *
+ * @sa xTopicSubscribe()
+ * @sa xTopicPublish()
+ * @sa xTopicDelete()
+ *
+ * @param limit_ The maximum number of queues that can subscribe to the topic.
+ * @return xTopic A topic is returned if successful, otherwise null is returned if unsuccessful.
+ *
+ * @warning The topic memory can only be freed by xTopicDelete().
+ */
+xTopic xTopicCreate(const xBase limit_);
+
+/**
+ * @brief System call to delete a topic.
+ *
+ * The xTopicDelete() system call will delete a topic. Every queue subscribed to the topic is
+ * unsubscribed and the messages waiting in it are released. The queues themselves are not deleted.
+ *
+ * @sa xTopicCreate()
+ *
+ * @param topic_ The topic to delete.
+ */
+void xTopicDelete(xTopic topic_);
+
+/**
+ * @brief System call to subscribe a queue to a topic.
+ *
+ * The xTopicSubscribe() system call subscribes a queue to a topic. A queue can subscribe to only
+ * one topic and its message value must be large enough to hold a reference, which it is when the
+ * queue is created with xQueueCreate(). The queue must be empty. While it subscribes to a topic,
+ * the queue can only be sent to by xTopicPublish() and read by xTopicReceive(). xQueueSend(),
+ * xQueueReceive() and the other queue system calls that send or drop messages fail on it.
+ *
+ * @sa xTopicUnsubscribe()
+ *
+ * @param topic_ The topic to subscribe to.
+ * @param queue_ The queue to subscribe.
+ * @return xBase RETURN_SUCCESS if the queue was subscribed, otherwise RETURN_FAILURE if the topic is
+ * full, the queue already subscribes to a topic, is not empty or the queue's messages are too small.
+ */
+xBase xTopicSubscribe(xTopic topic_, xQueue queue_);
+
+/**
+ * @brief System call to unsubscribe a queue from a topic.
+ *
+ * The xTopicUnsubscribe() system call unsubscribes a queue from a topic. The messages waiting in
+ * the queue are released. xQueueDelete() unsubscribes the queue it deletes.
+ *
+ * @sa xTopicSubscribe()
+ *
+ * @param topic_ The topic to unsubscribe from.
+ * @param queue_ The queue to unsubscribe.
+ * @return xBase RETURN_SUCCESS if the queue was unsubscribed, otherwise RETURN_FAILURE.
+ */
+xBase xTopicUnsubscribe(xTopic topic_, xQueue queue_);
+
+/**
+ * @brief System call to publish a message to a topic.
+ *
+ * The xTopicPublish() system call publishes a message to every queue subscribed to a topic. A
+ * subscriber that is full or locked misses the message. If no subscriber receives the message
+ * it is freed before xTopicPublish() returns.
+ *
+ * @sa xTopicReceive()
+ *
+ * @param topic_ The topic to publish to.
+ * @param messageBytes_ The number of bytes contained in the message value.
+ * @param messageValue_ The message value.
+ * @return xBase The number of subscribers the message was delivered to.
+ */
+xBase xTopicPublish(xTopic topic_, const xSize messageBytes_, const xByte *messageValue_);
+
+/**
+ * @brief System call to receive a message published to a topic.
+ *
+ * The xTopicReceive() system call receives the next message from a queue subscribed to a topic.
+ * The message is not copied, so the same message is returned to every subscriber.
+ *
+ * @sa xTopicRelease()
+ *
+ * @param queue_ The queue subscribed to the topic.
+ * @return xTopicMessage The message if one is waiting, otherwise null.
+ *
+ * @warning The message must be released by xTopicRelease() and not by xMemFree().
+ */
+xTopicMessage xTopicReceive(xQueue queue_);
+
+/**
+ * @brief System call to release a message published to a topic.
+ *
+ * The xTopicRelease() system call releases a message returned by xTopicReceive(). The message
+ * is freed once every subscriber that received it has released it.
+ *
+ * @sa xTopicReceive()
+ *
+ * @param message_ The message to release.
+ */
+void xTopicRelease(xTopicMessage message_);
+
+/**
+ * @brief System call to create a single-producer, single-consumer queue.
+ *
+ * The xSPSCQueueCreate() system call creates a lock-free queue for passing fixed size messages
+ * from exactly one producer to exactly one consumer, typically from an interrupt handler to a
+ * task. Sending and receiving never disable interrupts, allocate memory or walk the kernel memory
+ * region, so xSPSCQueueSend() can be called from an interrupt handler at a small, bounded cost.
+ * Memory ordering between the producer and consumer is enforced with the port's MEMORY_BARRIER().
+ *
+ * @sa xSPSCQueue
+ * @sa xSPSCQueueSend()
+ * @sa xSPSCQueueReceive()
+ * @sa xSPSCQueueDelete()
+ *
+ * @param limit_ The message limit for the queue. The minimum limit for queues is dependent on the
+ * setting CONFIG_QUEUE_MINIMUM_LIMIT. The limit must be less than the largest value of xBase.
+ * @param messageBytes_ The largest message value, in bytes, the queue can hold. Must be greater
+ * than zero and less than or equal to CONFIG_MESSAGE_VALUE_BYTES.
+ * @return xSPSCQueue A queue is returned if successful, otherwise null is returned if unsuccessful.
+ *
+ * @warning The queue memory can only be freed by xSPSCQueueDelete().
+ */
+xSPSCQueue xSPSCQueueCreate(const xBase limit_, const xBase messageBytes_);
+
+/**
+ * @brief System call to delete a single-producer, single-consumer queue.
+ *
+ * The xSPSCQueueDelete() system call will delete a queue created by xSPSCQueueCreate() regardless
+ * of how many messages it contains.
+ *
+ * @sa xSPSCQueueCreate()
+ *
+ * @param queue_ The queue to be deleted.
+ *
+ * @warning The producer and consumer must both be finished with the queue before it is deleted.
+ */
+void xSPSCQueueDelete(xSPSCQueue queue_);
+
+/**
+ * @brief System call to send a message using a single-producer, single-consumer queue.
+ *
+ * The xSPSCQueueSend() system call will send a message using the specified queue. It is safe to
+ * call from an interrupt handler as long as it is the queue's only producer.
+ *
+ * @sa xSPSCQueueReceive()
+ *
+ * @param queue_ The queue to send the message to.
+ * @param messageBytes_ The number of bytes contained in the message value.
+ * @param messageValue_ The message value.
+ * @return xBase RETURN_SUCCESS if the message was sent, otherwise RETURN_FAILURE if the queue is
+ * full or the parameters are invalid.
+ *
+ * @note To keep its cost bounded, xSPSCQueueSend() does not validate the queue handle against the
+ * kernel memory region and makes no system assertions.
+ */
+xBase xSPSCQueueSend(xSPSCQueue queue_, const xBase messageBytes_, const xChar *messageValue_);
+
+/**
+ * @brief System call to receive the next message from a single-producer, single-consumer queue.
+ *
+ * The xSPSCQueueReceive() system call will copy the next message in the queue into the end-user's
+ * queue message and drop it from the queue. It must only be called by the queue's only consumer.
+ *
+ * @sa xSPSCQueueSend()
+ *
+ * @param queue_ The queue to receive the message from.
+ * @param message_ The queue message to copy the message into.
+ * @return xBase RETURN_SUCCESS if a message was received, otherwise RETURN_FAILURE if the queue is
+ * empty or the parameters are invalid.
+ */
+xBase xSPSCQueueReceive(xSPSCQueue queue_, xQueueMessage message_);
+
+/**
+ * @brief System call to return the number of messages in a single-producer, single-consumer queue.
+ *
+ * The xSPSCQueueGetLength() system call returns the number of messages in the queue. If the producer
+ * or consumer is running concurrently the value may already be stale when it is returned.
+ *
+ * @param queue_ The queue to return the length of.
+ * @return xBase The number of messages in the queue.
+ */
+xBase xSPSCQueueGetLength(const xSPSCQueue queue_);
+
+/**
+ * @brief The xStreamCreate() system call will create a new stream buffer.
+ *
+ * The xStreamCreate() system call will create a new stream buffer. The
+ * memory for a stream buffer is allocated from kernel memory and therefor
+ * cannot be freed by calling xMemFree().
+ *
+ * @return xStreamBuffer The newly created stream buffer.
+ *
+ * @warning The stream buffer created by xStreamCreate() must
+ * be freed by calling xStreamDelete().
+ */
+xStreamBuffer xStreamCreate(void);
+
+/**
+ * @brief The xStreamCreateEx() system call will create a new stream buffer of the specified capacity.
+ *
+ * The xStreamCreateEx() system call works like xStreamCreate() except the stream buffer
+ * holds capacity_ bytes instead of CONFIG_STREAM_BUFFER_BYTES. The buffer is allocated
+ * with the stream buffer, so a small control channel and a large log channel can each use
+ * only the memory they need.
+ *
+ * @sa xStreamCreate()
+ * @sa xStreamGetHighWater()
+ *
+ * @param capacity_ The number of bytes the stream buffer can hold.
+ * @return xStreamBuffer The newly created stream buffer, otherwise null if unsuccessful.
+ *
+ * @warning The stream buffer created by xStreamCreateEx() must
+ * be freed by calling xStreamDelete().
+ */
+xStreamBuffer xStreamCreateEx(const xHalfWord capacity_);
+
+/**
+ * @brief The xStreamGetHighWater() system call returns the most bytes the stream buffer has held.
+ *
+ * The xStreamGetHighWater() system call will return the highest length the stream buffer
+ * has reached since it was created. Comparing it with the capacity shows whether the stream
+ * buffer is sized to the needs of its channel.
+ *
+ * @sa xStreamCreateEx()
+ *
+ * @param stream_ The stream buffer to operate on.
+ * @return xHalfWord The highest length of the stream buffer in bytes.
+ */
+xHalfWord xStreamGetHighWater(const xStreamBuffer stream_);
+
+/**
+ * @brief The xStreamSetTriggerLevel() system call sets the trigger level of a stream buffer.
+ *
+ * The xStreamSetTriggerLevel() system call binds a consumer task to a stream buffer with a
+ * trigger level. When a send fills the stream buffer from below the trigger level to the
+ * trigger level or above, the task is sent a direct to task notification whose one byte value
+ * is STREAM_TRIGGER_NOTIFICATION. The task is notified again only after the stream buffer has
+ * been drained below the trigger level. This lets the consumer wait for a useful amount of data
+ * instead of polling xStreamBytesAvailable() or waking on every byte. Setting the trigger level
+ * to zero removes the trigger.
+ *
+ * @sa xTaskNotifyGive()
+ * @sa xTaskWaitOn()
+ *
+ * @param stream_ The stream buffer to operate on.
+ * @param level_ The trigger level in bytes, or zero to remove the trigger.
+ * @param task_ The task to notify, may be null if level_ is zero.
+ * @return xBase RETURN_SUCCESS if the trigger level was set, otherwise RETURN_FAILURE if the
+ * trigger level is larger than the capacity of the stream buffer.
+ */
+xBase xStreamSetTriggerLevel(xStreamBuffer stream_, const xHalfWord level_, xTask task_);
+
+/**
+ * @brief The xStreamDelete() system call will delete a stream buffer
+ *
+ * The xStreamDelete() system call will delete a stream buffer and
+ * free its memory. Once a stream buffer is deleted, it can not
+ * be written to or read from.
+ *
+ * @param stream_ The stream buffer to operate on.
+ */
+void xStreamDelete(const xStreamBuffer stream_);
 
 /**
  * @brief The xStreamSend() system call will write one byte to the stream buffer
  *
  * The xStreamSend() system call will write one byte to the stream buffer. If the
- * stream buffer's length is equal to CONFIG_STREAM_BUFFER_BYTES (i.e., full) then
+ * stream buffer's length is equal to its capacity (i.e., full) then
  * the byte will not be written to the stream buffer and xStreamSend() will return
- * RETURN_FAILURE.
+ * RETURN_FAILURE. The stream buffer is a ring, so a producer can keep writing while a
+ * consumer receives without the buffer ever being cleared or shifted.
  *
  * @param stream_ The stream buffer to operate on.
  * @param byte_ The byte to be sent to the stream buffer.
@@ -1069,12 +2079,32 @@ void xStreamDelete(const xStreamBuffer stream_);
  */
 xBase xStreamSend(xStreamBuffer stream_, const xByte byte_);
 
+/**
+ * @brief The xStreamSendBytes() system call will write several bytes to the stream buffer
+ *
+ * The xStreamSendBytes() system call will write an array of bytes to the stream buffer. The
+ * stream buffer is validated once and the bytes are copied in one pass, which is much cheaper
+ * than calling xStreamSend() once per byte when writing a frame. In STREAM_SEND_ALL_OR_NOTHING
+ * mode either every byte is written or none are. In STREAM_SEND_PARTIAL mode as many bytes as
+ * fit are written.
+ *
+ * @sa xStreamSend()
+ *
+ * @param stream_ The stream buffer to operate on.
+ * @param bytes_ The bytes to be sent to the stream buffer.
+ * @param length_ The number of bytes to be sent.
+ * @param mode_ Either STREAM_SEND_ALL_OR_NOTHING or STREAM_SEND_PARTIAL.
+ * @return xHalfWord The number of bytes written to the stream buffer.
+ */
+xHalfWord xStreamSendBytes(xStreamBuffer stream_, const xByte *bytes_, const xHalfWord length_, const xBase mode_);
+
 /**
  * @brief The xStreamReceive() system call will return the contents of the stream buffer.
  *
  * The xStreamReceive() system call will return the contents of the stream buffer. The
  * contents are returned as a byte array whose length is known by the bytes_ paramater.
  * Because the byte array is stored in the heap, it must be freed by calling xMemFree().
+ * Only the bytes received are consumed from the stream buffer, which is not cleared.
  *
  * @param stream_ The stream to operate on.
  * @param bytes_ The number of bytes returned (i.e., length of the byte array) by xStreamReceive().
@@ -1084,6 +2114,44 @@ xBase xStreamSend(xStreamBuffer stream_, const xByte byte_);
  */
 xByte *xStreamReceive(const xStreamBuffer stream_, xHalfWord *bytes_);
 
+/**
+ * @brief The xStreamReceiveInto() system call will receive bytes into the end-user's buffer.
+ *
+ * The xStreamReceiveInto() system call will copy up to max_ bytes from the stream buffer into
+ * the end-user's buffer and consume them. Bytes that don't fit stay in the stream buffer for
+ * the next receive. Unlike xStreamReceive(), it does not allocate heap memory so there is
+ * nothing to free and a consumer can drain the stream buffer with a fixed working buffer.
+ *
+ * @sa xStreamReceive()
+ * @sa xStreamPeekInto()
+ *
+ * @param stream_ The stream buffer to operate on.
+ * @param bytes_ The buffer to copy the bytes into.
+ * @param max_ The size of the buffer in bytes.
+ * @param received_ The number of bytes copied into the buffer.
+ * @return xBase RETURN_SUCCESS if any bytes were received, otherwise RETURN_FAILURE if the
+ * stream buffer is empty or a parameter is invalid.
+ */
+xBase xStreamReceiveInto(const xStreamBuffer stream_, xByte *bytes_, const xHalfWord max_, xHalfWord *received_);
+
+/**
+ * @brief The xStreamPeekInto() system call will copy bytes into the end-user's buffer without
+ * consuming them.
+ *
+ * The xStreamPeekInto() system call works like xStreamReceiveInto() except the bytes copied
+ * stay in the stream buffer.
+ *
+ * @sa xStreamReceiveInto()
+ *
+ * @param stream_ The stream buffer to operate on.
+ * @param bytes_ The buffer to copy the bytes into.
+ * @param max_ The size of the buffer in bytes.
+ * @param received_ The number of bytes copied into the buffer.
+ * @return xBase RETURN_SUCCESS if any bytes were copied, otherwise RETURN_FAILURE if the
+ * stream buffer is empty or a parameter is invalid.
+ */
+xBase xStreamPeekInto(const xStreamBuffer stream_, xByte *bytes_, const xHalfWord max_, xHalfWord *received_);
+
 /**
  * @brief The xStreamBytesAvailable() system call returns the length of the stream buffer.
  *
@@ -1122,16 +2190,311 @@ xBase xStreamIsEmpty(const xStreamBuffer stream_);
  * @brief The xStreamIsFull() system call returns true if the stream buffer is full
  *
  * The xStreamIsFull() system call is used to determine if the stream buffer is full.
- * A stream buffer is considered full when it's length is equal to CONFIG_STREAM_BUFFER_BYTES.
- * If the buffer is less than CONFIG_STREAM_BUFFER_BYTES in length, xStreamIsFull()
+ * A stream buffer is considered full when it's length is equal to its capacity.
+ * If the buffer is less than its capacity in length, xStreamIsFull()
  * will return false.
  *
  * @param stream_ The stream buffer to operate on.
- * @return xBase Returns true if the stream buffer is equal to CONFIG_STREAM_BUFFER_BYTES
+ * @return xBase Returns true if the stream buffer is equal to its capacity
  * in length, otherwise xStreamIsFull() will return false.
  */
 xBase xStreamIsFull(const xStreamBuffer stream_);
 
+/**
+ * @brief The xMessageBufferCreate() system call will create a new message buffer.
+ *
+ * The xMessageBufferCreate() system call will create a message buffer. A message buffer
+ * carries variable length frames such as packets or log lines. The frames are stored in the
+ * ring of a stream buffer, each prefixed with its length, and are always written and read
+ * whole. A frame can be copied in and out with xMessageBufferSend() and xMessageBufferReceive()
+ * or built and read in place with xMessageBufferReserve(), xMessageBufferCommit(),
+ * xMessageBufferAcquire() and xMessageBufferRelease(). Each frame uses MESSAGE_BUFFER_HEADER_BYTES
+ * bytes of the capacity for its length and a frame never wraps around the end of the ring,
+ * so some capacity may go unused when it does not fit at the end.
+ *
+ * @param capacity_ The number of bytes in the message buffer's ring.
+ * @return xMessageBuffer The newly created message buffer, otherwise null if unsuccessful.
+ *
+ * @warning The message buffer created by xMessageBufferCreate() must
+ * be freed by calling xMessageBufferDelete().
+ */
+xMessageBuffer xMessageBufferCreate(const xHalfWord capacity_);
+
+/**
+ * @brief The xMessageBufferDelete() system call will delete a message buffer.
+ *
+ * @sa xMessageBufferCreate()
+ *
+ * @param buffer_ The message buffer to operate on.
+ */
+void xMessageBufferDelete(xMessageBuffer buffer_);
+
+/**
+ * @brief The xMessageBufferSend() system call will write a frame to the message buffer.
+ *
+ * The xMessageBufferSend() system call will copy a frame into the message buffer. Either
+ * the whole frame is written or, if there is not enough room, nothing is.
+ *
+ * @param buffer_ The message buffer to operate on.
+ * @param bytes_ The number of bytes in the frame.
+ * @param value_ The frame to write.
+ * @return xBase RETURN_SUCCESS if the frame was written, otherwise RETURN_FAILURE.
+ */
+xBase xMessageBufferSend(xMessageBuffer buffer_, const xHalfWord bytes_, const xByte *value_);
+
+/**
+ * @brief The xMessageBufferReceive() system call will read a frame from the message buffer.
+ *
+ * The xMessageBufferReceive() system call will copy the next frame into the end-user's buffer
+ * and consume it. If the frame is larger than the end-user's buffer, it is left in the message
+ * buffer and xMessageBufferReceive() returns RETURN_FAILURE.
+ *
+ * @param buffer_ The message buffer to operate on.
+ * @param value_ The buffer to copy the frame into.
+ * @param max_ The size of the buffer in bytes.
+ * @param received_ The number of bytes in the frame received.
+ * @return xBase RETURN_SUCCESS if a frame was received, otherwise RETURN_FAILURE.
+ */
+xBase xMessageBufferReceive(xMessageBuffer buffer_, xByte *value_, const xHalfWord max_, xHalfWord *received_);
+
+/**
+ * @brief The xMessageBufferReserve() system call will reserve room for a frame in the message buffer.
+ *
+ * The xMessageBufferReserve() system call will reserve room for a frame and return a pointer to
+ * it so the frame can be built in place without a copy. The frame is not visible to the reader
+ * until it is committed by xMessageBufferCommit(). Only one frame can be reserved at a time.
+ *
+ * @sa xMessageBufferCommit()
+ *
+ * @param buffer_ The message buffer to operate on.
+ * @param bytes_ The number of bytes to reserve.
+ * @return xByte* A pointer to the reserved frame, otherwise null if there is not enough room or
+ * a frame is already reserved.
+ */
+xByte *xMessageBufferReserve(xMessageBuffer buffer_, const xHalfWord bytes_);
+
+/**
+ * @brief The xMessageBufferCommit() system call will commit a reserved frame.
+ *
+ * The xMessageBufferCommit() system call will commit the frame reserved by xMessageBufferReserve()
+ * so the reader can see it. The frame may be committed with fewer bytes than were reserved.
+ * Committing zero bytes cancels the reservation.
+ *
+ * @sa xMessageBufferReserve()
+ *
+ * @param buffer_ The message buffer to operate on.
+ * @param bytes_ The number of bytes in the frame.
+ * @return xBase RETURN_SUCCESS if the frame was committed, otherwise RETURN_FAILURE if no frame is
+ * reserved or bytes_ is more than was reserved.
+ */
+xBase xMessageBufferCommit(xMessageBuffer buffer_, const xHalfWord bytes_);
+
+/**
+ * @brief The xMessageBufferAcquire() system call will return the next frame in place.
+ *
+ * The xMessageBufferAcquire() system call will return a pointer to the next frame without
+ * copying it. The frame stays in the message buffer until it is released by
+ * xMessageBufferRelease(). Only one frame can be acquired at a time.
+ *
+ * @sa xMessageBufferRelease()
+ *
+ * @param buffer_ The message buffer to operate on.
+ * @param bytes_ The number of bytes in the frame.
+ * @return xByte* A pointer to the frame, otherwise null if the message buffer is empty or a frame
+ * is already acquired.
+ */
+xByte *xMessageBufferAcquire(xMessageBuffer buffer_, xHalfWord *bytes_);
+
+/**
+ * @brief The xMessageBufferRelease() system call will consume an acquired frame.
+ *
+ * @sa xMessageBufferAcquire()
+ *
+ * @param buffer_ The message buffer to operate on.
+ * @return xBase RETURN_SUCCESS if the frame was released, otherwise RETURN_FAILURE if no frame is
+ * acquired.
+ */
+xBase xMessageBufferRelease(xMessageBuffer buffer_);
+
+/**
+ * @brief The xMessageBufferGetFrames() system call returns the number of frames waiting.
+ *
+ * @param buffer_ The message buffer to operate on.
+ * @return xHalfWord The number of frames waiting in the message buffer.
+ */
+xHalfWord xMessageBufferGetFrames(const xMessageBuffer buffer_);
+
+/**
+ * @brief The xMessageBufferGetBytes() system call returns the number of bytes waiting.
+ *
+ * The xMessageBufferGetBytes() system call returns the number of bytes in the frames waiting
+ * in the message buffer, not counting their length prefixes.
+ *
+ * @param buffer_ The message buffer to operate on.
+ * @return xHalfWord The number of bytes waiting in the message buffer.
+ */
+xHalfWord xMessageBufferGetBytes(const xMessageBuffer buffer_);
+
+/**
+ * @brief The xPipeCreate() system call will connect a device and a stream buffer.
+ *
+ * The xPipeCreate() system call creates a pipe that moves bytes between a device and a stream
+ * buffer without a task. In the PIPE_DEVICE_TO_STREAM direction, the scheduler reads from the
+ * device into the stream buffer whenever the device is available and the stream buffer has room.
+ * In the PIPE_STREAM_TO_DEVICE direction, the scheduler writes from the stream buffer to the device
+ * whenever the stream buffer has bytes. The device driver's read and write functions are given
+ * the stream buffer's ring directly, so no heap memory is allocated and there is no intermediate
+ * copy. Each pass of the scheduler moves at most one contiguous piece of the ring per pipe.
+ *
+ * @sa xPipeDelete()
+ * @sa xDeviceRegisterDevice()
+ *
+ * @param uid_ The unique identifier of the device.
+ * @param stream_ The stream buffer to connect the device to.
+ * @param direction_ Either PIPE_DEVICE_TO_STREAM or PIPE_STREAM_TO_DEVICE.
+ * @return xPipe The newly created pipe, otherwise null if the device can't be found or its mode
+ * does not allow the direction.
+ *
+ * @warning A device driver's read function must not read more bytes than it is offered in its
+ * size parameter. The pipe is deleted when its stream buffer is deleted.
+ */
+xPipe xPipeCreate(const xHalfWord uid_, xStreamBuffer stream_, const xBase direction_);
+
+/**
+ * @brief The xPipeDelete() system call will delete a pipe.
+ *
+ * The xPipeDelete() system call will delete a pipe. The device and the stream buffer are
+ * left as they are.
+ *
+ * @sa xPipeCreate()
+ *
+ * @param pipe_ The pipe to delete.
+ */
+void xPipeDelete(xPipe pipe_);
+
+/**
+ * @brief The xPipeGetBytesMoved() system call returns the number of bytes a pipe has moved.
+ *
+ * @sa xPipeCreate()
+ *
+ * @param pipe_ The pipe to operate on.
+ * @return xWord The number of bytes the pipe has moved between its device and stream buffer.
+ */
+xWord xPipeGetBytesMoved(const xPipe pipe_);
+
+/**
+ * @brief The xBroadcastStreamCreate() system call will create a broadcast stream.
+ *
+ * The xBroadcastStreamCreate() system call creates a broadcast stream. A broadcast stream is a
+ * ring of bytes written once and read by several readers, each with its own read cursor, so a
+ * byte stream can be fanned out to several consumers without copying it for each one. The policy
+ * decides what happens when a reader falls behind. With BROADCAST_STREAM_BACKPRESSURE the writer
+ * can only write as many bytes as the slowest reader has room for. With BROADCAST_STREAM_OVERWRITE
+ * the writer never waits and a reader that falls behind loses its oldest bytes.
+ *
+ * @sa xBroadcastStreamAddReader()
+ * @sa xBroadcastStreamSend()
+ * @sa xBroadcastStreamReceive()
+ *
+ * @param capacity_ The number of bytes the broadcast stream can hold.
+ * @param readers_ The maximum number of readers.
+ * @param policy_ Either BROADCAST_STREAM_BACKPRESSURE or BROADCAST_STREAM_OVERWRITE.
+ * @return xBroadcastStream The newly created broadcast stream, otherwise null if unsuccessful.
+ *
+ * @warning The broadcast stream created by xBroadcastStreamCreate() must
+ * be freed by calling xBroadcastStreamDelete().
+ */
+xBroadcastStream xBroadcastStreamCreate(const xHalfWord capacity_, const xBase readers_, const xBase policy_);
+
+/**
+ * @brief The xBroadcastStreamDelete() system call will delete a broadcast stream.
+ *
+ * @sa xBroadcastStreamCreate()
+ *
+ * @param stream_ The broadcast stream to delete.
+ */
+void xBroadcastStreamDelete(xBroadcastStream stream_);
+
+/**
+ * @brief The xBroadcastStreamAddReader() system call will add a reader to a broadcast stream.
+ *
+ * The xBroadcastStreamAddReader() system call adds a reader to a broadcast stream and returns
+ * its reader number. A reader only receives the bytes sent after it was added.
+ *
+ * @sa xBroadcastStreamRemoveReader()
+ *
+ * @param stream_ The broadcast stream to operate on.
+ * @param reader_ The reader number of the new reader.
+ * @return xBase RETURN_SUCCESS if the reader was added, otherwise RETURN_FAILURE if the
+ * broadcast stream has no room for another reader.
+ */
+xBase xBroadcastStreamAddReader(xBroadcastStream stream_, xBase *reader_);
+
+/**
+ * @brief The xBroadcastStreamRemoveReader() system call will remove a reader from a broadcast stream.
+ *
+ * The xBroadcastStreamRemoveReader() system call removes a reader from a broadcast stream. The
+ * bytes it has not read no longer hold back the writer.
+ *
+ * @sa xBroadcastStreamAddReader()
+ *
+ * @param stream_ The broadcast stream to operate on.
+ * @param reader_ The reader number.
+ * @return xBase RETURN_SUCCESS if the reader was removed, otherwise RETURN_FAILURE.
+ */
+xBase xBroadcastStreamRemoveReader(xBroadcastStream stream_, const xBase reader_);
+
+/**
+ * @brief The xBroadcastStreamSend() system call will write bytes to a broadcast stream.
+ *
+ * The xBroadcastStreamSend() system call writes bytes to a broadcast stream once for all of its
+ * readers. With BROADCAST_STREAM_BACKPRESSURE as many bytes as the slowest reader has room for are
+ * written. With BROADCAST_STREAM_OVERWRITE every byte up to the capacity is written.
+ *
+ * @param stream_ The broadcast stream to operate on.
+ * @param bytes_ The bytes to write.
+ * @param length_ The number of bytes to write.
+ * @return xHalfWord The number of bytes written.
+ */
+xHalfWord xBroadcastStreamSend(xBroadcastStream stream_, const xByte *bytes_, const xHalfWord length_);
+
+/**
+ * @brief The xBroadcastStreamReceive() system call will receive bytes for a reader of a broadcast stream.
+ *
+ * The xBroadcastStreamReceive() system call copies up to max_ bytes waiting for the reader into
+ * the end-user's buffer and moves the reader's cursor past them. The other readers are not affected.
+ *
+ * @param stream_ The broadcast stream to operate on.
+ * @param reader_ The reader number.
+ * @param bytes_ The buffer to copy the bytes into.
+ * @param max_ The size of the buffer in bytes.
+ * @param received_ The number of bytes copied into the buffer.
+ * @return xBase RETURN_SUCCESS if any bytes were received, otherwise RETURN_FAILURE.
+ */
+xBase xBroadcastStreamReceive(xBroadcastStream stream_, const xBase reader_, xByte *bytes_, const xHalfWord max_, xHalfWord *received_);
+
+/**
+ * @brief The xBroadcastStreamBytesAvailable() system call returns the bytes waiting for a reader.
+ *
+ * @param stream_ The broadcast stream to operate on.
+ * @param reader_ The reader number.
+ * @return xHalfWord The number of bytes waiting for the reader.
+ */
+xHalfWord xBroadcastStreamBytesAvailable(const xBroadcastStream stream_, const xBase reader_);
+
+/**
+ * @brief The xBroadcastStreamGetLost() system call returns the bytes a reader has lost.
+ *
+ * The xBroadcastStreamGetLost() system call returns the number of bytes a reader of a
+ * BROADCAST_STREAM_OVERWRITE broadcast stream lost because they were overwritten before it
+ * read them.
+ *
+ * @param stream_ The broadcast stream to operate on.
+ * @param reader_ The reader number.
+ * @return xWord The number of bytes the reader has lost.
+ */
+xWord xBroadcastStreamGetLost(const xBroadcastStream stream_, const xBase reader_);
+
 /**
  * @brief System call to initialize the system.
  *
@@ -1470,6 +2833,31 @@ void xTaskSuspend(xTask task_);
  */
 void xTaskWait(xTask task_);
 
+/**
+ * @brief System call to place a task in a waiting state until an object is ready.
+ *
+ * The xTaskWaitOn() system call will place a task in the waiting state and have the scheduler
+ * execute it while the object it waits on is ready. Queues and streams ready their waiting task
+ * directly when they are sent to, so the task does not have to poll them and costs nothing
+ * while it waits. Timers and devices have no sender so the scheduler checks them each time it
+ * visits the waiting task. An object may have only one waiting task and a task may wait on only
+ * one object. Deleting the task or the object releases the wait. Calling xTaskWaitOn() with
+ * TaskWaitConditionNone releases the wait without changing the task's state.
+ *
+ * @sa xTaskWaitCondition
+ * @sa xTaskWait()
+ *
+ * @param task_ The task to place in the waiting state.
+ * @param condition_ The condition to wait for.
+ * @param object_ The queue, stream or timer to wait on. Not used for
+ * TaskWaitConditionDeviceAvailable.
+ * @param value_ The number of bytes to wait for with TaskWaitConditionStreamBytes or the unique
+ * identifier of the device with TaskWaitConditionDeviceAvailable. Otherwise not used.
+ * @return xBase RETURN_SUCCESS if the task is waiting on the object, otherwise RETURN_FAILURE if
+ * the object is invalid or already has a waiting task.
+ */
+xBase xTaskWaitOn(xTask task_, const xTaskWaitCondition condition_, xAddr object_, const xHalfWord value_);
+
 /**
  * @brief System call to set the task timer period.
  *
@@ -1613,6 +3001,37 @@ xTicks xTaskGetWDPeriod(const xTask task_);
  */
 xTimer xTimerCreate(const xTicks timerPeriod_);
 
+/**
+ * @brief System call to create a new timer with a callback.
+ *
+ * The xTimerCreateCallback() system call will create a new timer that calls a callback when
+ * it expires. The callback is called by the scheduler so no task has to poll the timer, and
+ * when several timers expire together their callbacks are called in the order the timers
+ * expired. A one-shot timer is stopped after its callback is called. An auto-reload timer
+ * starts its next period at the time the last period ended rather than the time the callback
+ * was called, so it does not drift. Like xTimerCreate(), the timer is created stopped and
+ * must be started with xTimerStart().
+ *
+ * @sa xTimerCreate()
+ * @sa xTimerStart()
+ * @sa xTimerDelete()
+ *
+ * @param timerPeriod_ The number of ticks before the timer expires.
+ * @param oneShot_ True if the timer should stop after it expires once, false if the timer
+ * should start again each time it expires.
+ * @param callback_ The callback to call when the timer expires. The callback is passed the
+ * timer and the timer paramater.
+ * @param timerParameter_ The paramater to pass to the callback, may be null.
+ * @return xTimer The newly created timer. If the callback is null or the required memory
+ * could not be allocated, xTimerCreateCallback() will return null.
+ *
+ * @note The callback is called from within the scheduler so it should return quickly. It may
+ * stop, reset or delete any timer, including its own.
+ *
+ * @warning The timer memory can only be freed by xTimerDelete().
+ */
+xTimer xTimerCreateCallback(const xTicks timerPeriod_, const xBase oneShot_, void (*callback_)(xTimer timer_, xTimerParm parm_), xTimerParm timerParameter_);
+
 /**
  * @brief System call will delete a timer.
  *
@@ -1713,6 +3132,24 @@ void xTimerStart(xTimer timer_);
  */
 void xTimerStop(xTimer timer_);
 
+/**
+ * @brief System call to get the next running timer that has expired.
+ *
+ * The xTimerGetNextExpired() system call will return the next running timer that has expired.
+ * Running timers are kept on a timer wheel so finding the timers that have expired does not
+ * depend on how many timers exist. Timers are returned in the order they expired and each expiry
+ * is returned only once. Timers created by xTimerCreateCallback() are never returned because the
+ * scheduler calls their callback instead. A returned timer is returned again only after it has been reset with
+ * xTimerReset() or restarted with xTimerStart() and has expired again. Stopped timers and timers
+ * with a period of zero are never returned.
+ *
+ * @sa xTimerHasTimerExpired()
+ * @sa xTimerReset()
+ *
+ * @return xTimer The next timer that has expired, or null if no running timer has expired.
+ */
+xTimer xTimerGetNextExpired(void);
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 /* DO NOT USE - USE THE SYSASSERT() C MACRO INSTEAD! */
@@ -1727,6 +3164,7 @@ void __TaskStateClear__(void);
 void __MemoryRegionDumpKernel__(void);
 void __MemoryRegionDumpHeap__(void);
 void __DeviceStateClear__(void);
+void __StreamStateClear__(void);
 #endif
 
 #endif
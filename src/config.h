@@ -225,6 +225,52 @@
 
 
 
+
+/**
+ * @brief Define to enable message queue audits.
+ *
+ * By default, message queue system calls validate the queue handle in
+ * constant time by checking only the kernel memory entry that holds the
+ * queue. Defining CONFIG_ENABLE_QUEUE_AUDIT makes every message queue
+ * system call walk the entire kernel memory region to validate the queue
+ * handle and check that the queue's ring of messages is consistent. This
+ * is useful while debugging but makes the cost of every queue system call
+ * grow with the number of kernel objects. By default the
+ * CONFIG_ENABLE_QUEUE_AUDIT setting is not defined.
+ *
+ * @sa xQueueSend()
+ *
+ */
+/*
+ #if !defined(CONFIG_ENABLE_QUEUE_AUDIT)
+ #define CONFIG_ENABLE_QUEUE_AUDIT
+ #endif
+ */
+
+
+
+/**
+ * @brief Define to enable message queue statistics.
+ *
+ * Defining CONFIG_ENABLE_QUEUE_STATS makes every message queue count the
+ * messages sent, received, rejected because the queue was full and
+ * overwritten by a mailbox, track its highest length and measure how long
+ * each message waited in the queue. Every message is stamped with the
+ * time it was sent, so enabling statistics makes each message in a queue
+ * larger. The statistics are obtained by calling xQueueGetStats(). By
+ * default the CONFIG_ENABLE_QUEUE_STATS setting is not defined.
+ *
+ * @sa xQueueGetStats()
+ *
+ */
+/*
+ #if !defined(CONFIG_ENABLE_QUEUE_STATS)
+ #define CONFIG_ENABLE_QUEUE_STATS
+ #endif
+ */
+
+
+
 /**
  * @brief Define the length of the stream buffer.
  *
@@ -232,6 +278,7 @@
  * of stream buffers created by xStreamCreate(). When the length
  * of the stream buffer reaches this value, it is considered
  * full and can no longer be written to by calling xStreamSend().
+ * Stream buffers created by xStreamCreateEx() set their own length.
  * The default value is 32. The literal must be appended with "u" to maintain
  * MISRA C:2012 compliance.
  *
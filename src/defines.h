@@ -210,6 +210,223 @@
 
 
 
+/* Check only the entry of the address in constant time rather than walking
+   the entire memory region. */
+#if !defined(MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK)
+#define MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK 0x3u /* 3 */
+#endif
+
+
+
+/* Define the modes for xQueueSendBatch(). In all or nothing mode either every
+   message in the batch is sent or none are. In best effort mode as many messages
+   as fit are sent. */
+#if !defined(QUEUE_BATCH_ALL_OR_NOTHING)
+#define QUEUE_BATCH_ALL_OR_NOTHING 0x1u /* 1 */
+#endif
+
+
+
+#if !defined(QUEUE_BATCH_BEST_EFFORT)
+#define QUEUE_BATCH_BEST_EFFORT 0x2u /* 2 */
+#endif
+
+
+
+/* Define the modes for xStreamSendBytes(). In all or nothing mode either every
+   byte is written or none are. In partial mode as many bytes as fit are written. */
+#if !defined(STREAM_SEND_ALL_OR_NOTHING)
+#define STREAM_SEND_ALL_OR_NOTHING 0x1u /* 1 */
+#endif
+
+
+
+#if !defined(STREAM_SEND_PARTIAL)
+#define STREAM_SEND_PARTIAL 0x2u /* 2 */
+#endif
+
+
+
+/* Define the shape of the timer wheel. Each of the TIMER_WHEEL_LEVELS levels has
+   TIMER_WHEEL_SLOTS slots and each level's slot spans TIMER_WHEEL_SLOTS times the
+   ticks of the level below, so four levels of sixteen slots place timers due within
+   65536 ticks exactly. Timers due later wait in the top level and are placed again
+   when their slot comes around. */
+#if !defined(TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_BITS 0x4u /* 4 */
+#endif
+
+
+
+#if !defined(TIMER_WHEEL_SLOTS)
+#define TIMER_WHEEL_SLOTS 0x10u /* 16 */
+#endif
+
+
+
+#if !defined(TIMER_WHEEL_MASK)
+#define TIMER_WHEEL_MASK 0xFu /* 15 */
+#endif
+
+
+
+#if !defined(TIMER_WHEEL_LEVELS)
+#define TIMER_WHEEL_LEVELS 0x4u /* 4 */
+#endif
+
+
+
+/* Define the value xTimerCreate() stores in every timer so a pointer to another kernel
+   object is not mistaken for a timer. */
+#if !defined(TIMER_MAGIC)
+#define TIMER_MAGIC 0x544D5253u /* "TMRS" */
+#endif
+
+
+
+/* Define the lists expired timers wait on. Timers without a callback wait on the
+   polled list for xTimerGetNextExpired(), timers with a callback wait on the callback
+   list and are moved to the service list at the start of the scheduler pass that calls
+   them. A timer on an expired list has a wheel level of TIMER_WHEEL_LEVELS plus the list. */
+#if !defined(TIMER_EXPIRED_POLLED)
+#define TIMER_EXPIRED_POLLED 0x0u /* 0 */
+#endif
+
+
+
+#if !defined(TIMER_EXPIRED_CALLBACK)
+#define TIMER_EXPIRED_CALLBACK 0x1u /* 1 */
+#endif
+
+
+
+#if !defined(TIMER_EXPIRED_SERVICE)
+#define TIMER_EXPIRED_SERVICE 0x2u /* 2 */
+#endif
+
+
+
+#if !defined(TIMER_EXPIRED_LISTS)
+#define TIMER_EXPIRED_LISTS 0x3u /* 3 */
+#endif
+
+
+
+/* Define the directions of a pipe created by xPipeCreate(). */
+#if !defined(PIPE_DEVICE_TO_STREAM)
+#define PIPE_DEVICE_TO_STREAM 0x1u /* 1 */
+#endif
+
+
+
+#if !defined(PIPE_STREAM_TO_DEVICE)
+#define PIPE_STREAM_TO_DEVICE 0x2u /* 2 */
+#endif
+
+
+
+/* Define the policies of a broadcast stream for when a reader falls behind. With
+   backpressure the writer is limited by the slowest reader. With overwrite the
+   writer never waits and a slow reader loses its oldest bytes. */
+#if !defined(BROADCAST_STREAM_BACKPRESSURE)
+#define BROADCAST_STREAM_BACKPRESSURE 0x1u /* 1 */
+#endif
+
+
+
+#if !defined(BROADCAST_STREAM_OVERWRITE)
+#define BROADCAST_STREAM_OVERWRITE 0x2u /* 2 */
+#endif
+
+
+
+/* Define the number of bytes in the length prefix of a message buffer frame and
+   the length prefix value that marks the rest of the ring as unused so the next
+   frame starts at the beginning of the ring. */
+#if !defined(MESSAGE_BUFFER_HEADER_BYTES)
+#define MESSAGE_BUFFER_HEADER_BYTES sizeof(HalfWord_t)
+#endif
+
+
+
+#if !defined(MESSAGE_BUFFER_WRAP)
+#define MESSAGE_BUFFER_WRAP 0xFFFFu /* 65535 */
+#endif
+
+
+
+/* Define the number of message priorities for priority queues. Priorities
+   range from zero (lowest) to QUEUE_PRIORITY_LEVELS - 1 (highest). The
+   non-empty priorities are tracked as bits in a Base_t so there can be at
+   most eight. */
+#if !defined(QUEUE_PRIORITY_LEVELS)
+#define QUEUE_PRIORITY_LEVELS 0x8u /* 8 */
+#endif
+
+
+
+/* Define the index used to terminate the lists of slots in a priority
+   queue. */
+#if !defined(QUEUE_SLOT_NONE)
+#define QUEUE_SLOT_NONE 0xFFu /* 255 */
+#endif
+
+
+
+/* Define the number of buckets in the queue latency histogram. Bucket n
+   counts messages that waited in the queue for [2^n, 2^(n+1)) ticks, bucket
+   zero also counts messages that waited zero ticks and the last bucket
+   counts every message that waited longer. */
+#if !defined(QUEUE_LATENCY_HISTOGRAM_BUCKETS)
+#define QUEUE_LATENCY_HISTOGRAM_BUCKETS 0x10u /* 16 */
+#endif
+
+
+
+/* Define a macro to compute the number of bytes a message occupies in a
+   queue's ring. Each message is a Message_t header followed by its value,
+   rounded up to a whole number of headers so the next header is aligned. */
+#if !defined(QUEUE_RECORD_BYTES)
+#define QUEUE_RECORD_BYTES(messageBytes_) ((((Size_t)(messageBytes_) + sizeof(Message_t) + sizeof(Message_t) - 1u) / sizeof(Message_t)) * sizeof(Message_t))
+#endif
+
+
+
+/* Define the number of buckets in the memory region histograms. Bucket n
+   counts entries whose size in blocks is in the range [2^n, 2^(n+1)) so
+   sixteen buckets cover every possible HalfWord_t block count. */
+#if !defined(MEMORY_REGION_HISTOGRAM_BUCKETS)
+#define MEMORY_REGION_HISTOGRAM_BUCKETS 0x10u /* 16 */
+#endif
+
+
+
+/* Define the notification value sent to the task registered with
+   xMemSetHeapWatermark() when the heap memory region crosses its
+   watermark. */
+#if !defined(MEMORY_WATERMARK_HEAP_NOTIFICATION)
+#define MEMORY_WATERMARK_HEAP_NOTIFICATION 0x48u /* 'H' */
+#endif
+
+
+
+/* Define the notification value sent to the task registered with
+   xMemSetKernelWatermark() when the kernel memory region crosses its
+   watermark. */
+#if !defined(MEMORY_WATERMARK_KERNEL_NOTIFICATION)
+#define MEMORY_WATERMARK_KERNEL_NOTIFICATION 0x4Bu /* 'K' */
+#endif
+
+
+
+/* Define the notification value sent to the task registered with
+   xStreamSetTriggerLevel() when a stream fills to its trigger level. */
+#if !defined(STREAM_TRIGGER_NOTIFICATION)
+#define STREAM_TRIGGER_NOTIFICATION 0x53u /* 'S' */
+#endif
+
+
+
 /* Define a macro to convert a heap memory address to it's corresponding
    heap entry. */
 #if !defined(ADDR2ENTRY)
@@ -29,7 +29,6 @@
 static DeviceList_t *deviceList = NULL;
 
 
-static Device_t *__DeviceListFind__(const HalfWord_t uid_);
 
 
 
@@ -410,7 +409,7 @@ Base_t xDeviceRead(const HalfWord_t uid_, Size_t *size_, Addr_t *data_) {
 
 
 
-static Device_t *__DeviceListFind__(const HalfWord_t uid_) {
+Device_t *__DeviceListFind__(const HalfWord_t uid_) {
 
 
   Device_t *ret = NULL;
@@ -59,6 +59,7 @@ Base_t xDeviceSimpleRead(const HalfWord_t uid_, Word_t *data_);
 Base_t xDeviceRead(const HalfWord_t uid_, Size_t *size_, Addr_t *data_);
 Base_t xDeviceInitDevice(const HalfWord_t uid_);
 Base_t xDeviceConfigDevice(const HalfWord_t uid_, Size_t *size_, Addr_t *config_);
+Device_t *__DeviceListFind__(const HalfWord_t uid_);
 
 #if defined(POSIX_ARCH_OTHER)
 void __DeviceStateClear__(void);
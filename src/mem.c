@@ -31,10 +31,16 @@ static volatile MemoryRegion_t kernel;
 
 static Base_t __MemoryRegionCheck__(const volatile MemoryRegion_t *region_, const volatile Addr_t *addr_, const Base_t option_);
 static Base_t __MemoryRegionCheckAddr__(const volatile MemoryRegion_t *region_, const volatile Addr_t *addr_);
+static Base_t __MemoryRegionCheckEntry__(const volatile MemoryRegion_t *region_, const volatile Addr_t *addr_);
 static Addr_t *__calloc__(volatile MemoryRegion_t *region_, const Size_t size_);
 static void __free__(volatile MemoryRegion_t *region_, const volatile Addr_t *addr_);
 static MemoryRegionStats_t *__MemGetRegionStats__(const volatile MemoryRegion_t *region_);
-static void __DefragMemoryRegion__(const volatile MemoryRegion_t *region_);
+static void __DefragMemoryRegion__(volatile MemoryRegion_t *region_);
+static Base_t __MemoryRegionBucket__(const HalfWord_t blocks_);
+static Base_t __MemoryRegionSetWatermark__(volatile MemoryRegion_t *region_, const Size_t bytes_, void (*callback_)(const Size_t available_), Task_t *task_);
+static void __MemoryRegionWatermark__(volatile MemoryRegion_t *region_);
+static Base_t __MemoryRegionCompact__(volatile MemoryRegion_t *region_);
+static Size_t __MemoryRegionLargestFree__(const volatile MemoryRegion_t *region_);
 
 
 void __MemoryInit__(void) {
@@ -43,10 +49,14 @@ void __MemoryInit__(void) {
 
   heap.minAvailableEver = CONFIG_MEMORY_REGION_SIZE_IN_BLOCKS * CONFIG_MEMORY_REGION_BLOCK_SIZE;
 
+  heap.watermarkNotification = MEMORY_WATERMARK_HEAP_NOTIFICATION;
+
   __memset__(&kernel, 0x0, sizeof(MemoryRegion_t));
 
   kernel.minAvailableEver = CONFIG_MEMORY_REGION_SIZE_IN_BLOCKS * CONFIG_MEMORY_REGION_BLOCK_SIZE;
 
+  kernel.watermarkNotification = MEMORY_WATERMARK_KERNEL_NOTIFICATION;
+
   return;
 }
 
@@ -377,6 +387,65 @@ static Base_t __MemoryRegionCheckAddr__(const volatile MemoryRegion_t *region_,
 
 
 
+/* The __MemoryRegionCheckEntry__() function checks, in constant time, that an address points to memory
+   that is currently allocated in the memory region. Rather than walking every entry like __MemoryRegionCheck__(),
+   it only checks that the address's entry is inside the memory region, starts on a block boundary, is not free
+   and is immediately followed by its next entry. It does not check the consistency of the rest of the memory
+   region. */
+static Base_t __MemoryRegionCheckEntry__(const volatile MemoryRegion_t *region_, const volatile Addr_t *addr_) {
+
+
+  MemoryEntry_t *entry = NULL;
+
+  Word_t offset = zero;
+
+
+  Base_t ret = RETURN_FAILURE;
+
+
+  /* Assert if the memory region has not been initialized, is flagged corrupt
+     or if the address is null. */
+  SYSASSERT(ISNOTNULLPTR(region_->start) && (false == SYSFLAG_FAULT()) && ISNOTNULLPTR(addr_));
+
+
+  /* Check if the memory region has been initialized, is not flagged corrupt
+     and the address is not null. */
+  if (ISNOTNULLPTR(region_->start) && (false == SYSFLAG_FAULT()) && ISNOTNULLPTR(addr_)) {
+
+
+    entry = ADDR2ENTRY(addr_, region_);
+
+
+    /* Check if the entry is inside the scope of the memory region before we
+       read anything from it. */
+    if (RETURN_SUCCESS == __MemoryRegionCheckAddr__(region_, entry)) {
+
+
+      offset = (Word_t)((Byte_t *)entry - (Byte_t *)region_->mem);
+
+
+      /* Assert if the entry is not on a block boundary, if the entry is free, if
+         it is too small to hold any memory, if it runs past the end of the memory
+         region or if its next entry does not immediately follow it. */
+      SYSASSERT((zero == (offset % CONFIG_MEMORY_REGION_BLOCK_SIZE)) && (false == entry->free) && (region_->entrySize < entry->blocks) && (CONFIG_MEMORY_REGION_SIZE_IN_BLOCKS >= ((offset / CONFIG_MEMORY_REGION_BLOCK_SIZE) + entry->blocks)) && (ISNULLPTR(entry->next) || ((MemoryEntry_t *)((Byte_t *)entry + (entry->blocks * CONFIG_MEMORY_REGION_BLOCK_SIZE)) == entry->next)));
+
+
+      /* Check that the entry looks like an allocated entry, if so the address
+         is valid. */
+      if ((zero == (offset % CONFIG_MEMORY_REGION_BLOCK_SIZE)) && (false == entry->free) && (region_->entrySize < entry->blocks) && (CONFIG_MEMORY_REGION_SIZE_IN_BLOCKS >= ((offset / CONFIG_MEMORY_REGION_BLOCK_SIZE) + entry->blocks)) && (ISNULLPTR(entry->next) || ((MemoryEntry_t *)((Byte_t *)entry + (entry->blocks * CONFIG_MEMORY_REGION_BLOCK_SIZE)) == entry->next))) {
+
+
+        ret = RETURN_SUCCESS;
+      }
+    }
+  }
+
+
+  return ret;
+}
+
+
+
 /* A function to allocate memory and is similar to the standard libc calloc() but supports multiple memory regions. */
 static Addr_t *__calloc__(volatile MemoryRegion_t *region_, const Size_t size_) {
 
@@ -384,7 +453,7 @@ static Addr_t *__calloc__(volatile MemoryRegion_t *region_, const Size_t size_)
 
   HalfWord_t requested = zero;
 
-  HalfWord_t free = zero;
+  Base_t watermark = false;
 
   /* Intentionally underflow an unsigned data type
      to get its maximum value. */
@@ -399,6 +468,8 @@ static Addr_t *__calloc__(volatile MemoryRegion_t *region_, const Size_t size_)
 
   MemoryEntry_t *candidateNext = NULL;
 
+  Word_t granted = zero;
+
   /* Need to disable interrupts while modifying entries in
      a memory region. */
   DISABLE_INTERRUPTS();
@@ -469,6 +540,15 @@ static Addr_t *__calloc__(volatile MemoryRegion_t *region_, const Size_t size_)
 
         /* Because there is no next entry set it to null. */
         region_->start->next = NULL;
+
+
+        /* The whole memory region is one free entry so it is the only
+           entry in the free entry histogram. */
+        region_->freeEntryHistogram[__MemoryRegionBucket__(CONFIG_MEMORY_REGION_SIZE_IN_BLOCKS)]++;
+
+
+        /* All of the blocks in the memory region are free. */
+        region_->freeBlocks = CONFIG_MEMORY_REGION_SIZE_IN_BLOCKS;
       }
 
 
@@ -524,14 +604,6 @@ static Addr_t *__calloc__(volatile MemoryRegion_t *region_, const Size_t size_)
           }
 
 
-          /* Count how many blocks are free so we can update the minimum bytes free ever
-             for the memory region. */
-          if (true == cursor->free) {
-
-            free += cursor->blocks;
-          }
-
-
           cursor = cursor->next;
         }
 
@@ -545,6 +617,11 @@ static Addr_t *__calloc__(volatile MemoryRegion_t *region_, const Size_t size_)
         if (ISNOTNULLPTR(candidate)) {
 
 
+          /* The candidate is no longer free so remove it from the free entry
+             histogram. If it gets split, the remainder is added back below. */
+          region_->freeEntryHistogram[__MemoryRegionBucket__(candidate->blocks)]--;
+
+
 
           /* Check if we can split the blocks in the entry. If we can then proceed with
              splitting the blocks by putting the remainder in a new entry. */
@@ -568,19 +645,30 @@ static Addr_t *__calloc__(volatile MemoryRegion_t *region_, const Size_t size_)
 
 
 
-            /* Mark the new entry as free. */
+            /* Mark the new entry as free. The new entry sits in memory that may have
+               been used before so clear the rest of its memory entry too. */
             candidate->next->free = true;
 
+            candidate->next->movable = false;
+
+            candidate->next->slack = zero;
+
 
 
             /* Give the new entry the remaining blocks. */
             candidate->next->blocks = candidate->blocks - requested;
 
 
+            /* The new free entry needs to be counted in the free entry histogram. */
+            region_->freeEntryHistogram[__MemoryRegionBucket__(candidate->next->blocks)]++;
+
+
 
             /* Mark the candidate entry as in use. */
             candidate->free = false;
 
+            candidate->movable = false;
+
 
 
             /* Set the blocks of the candidate to requested. */
@@ -605,6 +693,8 @@ static Addr_t *__calloc__(volatile MemoryRegion_t *region_, const Size_t size_)
             /* Because we are unable to split the candidate, let's just claim it for France. */
             candidate->free = false;
 
+            candidate->movable = false;
+
 
 
             /* Clear the memory allocated. */
@@ -623,15 +713,46 @@ static Addr_t *__calloc__(volatile MemoryRegion_t *region_, const Size_t size_)
           region_->allocations++;
 
 
-          /* We just allocated memory, so subtract back out the requested blocks
-             before we set the minimum bytes available ever. */
-          free -= requested;
+          /* Count the allocation in its size class, the size class being
+             the log2 bucket of the blocks requested. */
+          region_->sizeClassAllocations[__MemoryRegionBucket__(requested)]++;
+
+
+          /* The bytes granted may exceed the bytes requested because memory is
+             handed out in blocks (and an unsplittable candidate is claimed whole).
+             Remember the difference in the entry so __free__() can back it out. */
+          granted = (candidate->blocks - region_->entrySize) * CONFIG_MEMORY_REGION_BLOCK_SIZE;
+
+          candidate->slack = (HalfWord_t)(granted - size_);
+
+          region_->requestedBytes += size_;
 
+          region_->grantedBytes += granted;
 
-          if ((free * CONFIG_MEMORY_REGION_BLOCK_SIZE) < region_->minAvailableEver) {
 
+          /* We just allocated memory, so subtract the blocks claimed from the free
+             block count before we set the minimum bytes available ever. The free
+             block count is maintained here and in __free__() so we never need to
+             walk the memory region to know how much memory is free. */
+          region_->freeBlocks -= candidate->blocks;
 
-            region_->minAvailableEver = (free * CONFIG_MEMORY_REGION_BLOCK_SIZE);
+
+          if ((region_->freeBlocks * CONFIG_MEMORY_REGION_BLOCK_SIZE) < region_->minAvailableEver) {
+
+
+            region_->minAvailableEver = (region_->freeBlocks * CONFIG_MEMORY_REGION_BLOCK_SIZE);
+          }
+
+
+          /* Check if this allocation took the memory region below its watermark. The
+             watermark is only acted on once until memory is freed above it again. */
+          if ((zero < region_->watermarkBytes) && (false == region_->watermarkTripped) &&
+              ((region_->freeBlocks * CONFIG_MEMORY_REGION_BLOCK_SIZE) < region_->watermarkBytes)) {
+
+
+            region_->watermarkTripped = true;
+
+            watermark = true;
           }
         }
       }
@@ -643,6 +764,14 @@ static Addr_t *__calloc__(volatile MemoryRegion_t *region_, const Size_t size_)
 
   ENABLE_INTERRUPTS();
 
+
+  /* The watermark callback and task notification are made with interrupts
+     enabled because they are allowed to make system calls (e.g., xMemFree()). */
+  if (true == watermark) {
+
+    __MemoryRegionWatermark__(region_);
+  }
+
   return ret;
 }
 
@@ -654,6 +783,8 @@ static void __free__(volatile MemoryRegion_t *region_, const volatile Addr_t *ad
 
   MemoryEntry_t *free = NULL;
 
+  Word_t granted = zero;
+
   /* Need to disable interrupts while modifying entries in
      a memory region. */
   DISABLE_INTERRUPTS();
@@ -692,6 +823,43 @@ static void __free__(volatile MemoryRegion_t *region_, const volatile Addr_t *ad
       region_->frees++;
 
 
+      /* Back out the bytes requested and granted for the entry. */
+      granted = (free->blocks - region_->entrySize) * CONFIG_MEMORY_REGION_BLOCK_SIZE;
+
+      region_->requestedBytes -= granted - free->slack;
+
+      region_->grantedBytes -= granted;
+
+      free->slack = zero;
+
+
+      /* The entry is free again so count it in the free entry histogram. */
+      region_->freeEntryHistogram[__MemoryRegionBucket__(free->blocks)]++;
+
+
+      region_->freeBlocks += free->blocks;
+
+
+      /* If the entry belonged to a memory handle, it is no longer movable. */
+      if (true == free->movable) {
+
+        free->movable = false;
+
+        region_->movableEntries--;
+      }
+
+
+      /* Freeing memory may have opened a hole that movable memory can be slid into. */
+      region_->compactable = true;
+
+
+      /* Re-arm the watermark once the free memory has climbed back to it. */
+      if ((true == region_->watermarkTripped) && ((region_->freeBlocks * CONFIG_MEMORY_REGION_BLOCK_SIZE) >= region_->watermarkBytes)) {
+
+        region_->watermarkTripped = false;
+      }
+
+
       /* After freeing blocks we should defrag the memory
          region. */
       __DefragMemoryRegion__(region_);
@@ -733,7 +901,24 @@ void __KernelFreeMemory__(const volatile Addr_t *addr_) {
    regions cannot be accessed outside the scope of mem.c. */
 Base_t __MemoryRegionCheckKernel__(const volatile Addr_t *addr_, const Base_t option_) {
 
-  return __MemoryRegionCheck__(&kernel, addr_, option_);
+  Base_t ret = RETURN_FAILURE;
+
+
+  /* If the quick option was specified, only check the address's entry
+     rather than walking the entire memory region. */
+  if (MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK == option_) {
+
+
+    ret = __MemoryRegionCheckEntry__(&kernel, addr_);
+
+  } else {
+
+
+    ret = __MemoryRegionCheck__(&kernel, addr_, option_);
+  }
+
+
+  return ret;
 }
 
 
@@ -764,7 +949,24 @@ void __HeapFreeMemory__(const volatile Addr_t *addr_) {
    regions cannot be accessed outside the scope of mem.c. */
 Base_t __MemoryRegionCheckHeap__(const volatile Addr_t *addr_, const Base_t option_) {
 
-  return __MemoryRegionCheck__(&heap, addr_, option_);
+  Base_t ret = RETURN_FAILURE;
+
+
+  /* If the quick option was specified, only check the address's entry
+     rather than walking the entire memory region. */
+  if (MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK == option_) {
+
+
+    ret = __MemoryRegionCheckEntry__(&heap, addr_);
+
+  } else {
+
+
+    ret = __MemoryRegionCheck__(&heap, addr_, option_);
+  }
+
+
+  return ret;
 }
 
 
@@ -857,6 +1059,469 @@ MemoryRegionStats_t *xMemGetKernelStats(void) {
 
 
 
+/* The xMemSetHeapWatermark() system call sets the low-water threshold, in bytes,
+   for the heap memory region. */
+Base_t xMemSetHeapWatermark(const Size_t bytes_, void (*callback_)(const Size_t available_), Task_t *task_) {
+
+
+  return __MemoryRegionSetWatermark__(&heap, bytes_, callback_, task_);
+}
+
+
+
+/* The xMemSetKernelWatermark() system call sets the low-water threshold, in bytes,
+   for the kernel memory region. */
+Base_t xMemSetKernelWatermark(const Size_t bytes_, void (*callback_)(const Size_t available_), Task_t *task_) {
+
+
+  return __MemoryRegionSetWatermark__(&kernel, bytes_, callback_, task_);
+}
+
+
+
+/* Set the watermark for the specified memory region. Setting the watermark to zero
+   bytes disables it. */
+static Base_t __MemoryRegionSetWatermark__(volatile MemoryRegion_t *region_, const Size_t bytes_, void (*callback_)(const Size_t available_), Task_t *task_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+
+  /* Assert if a non-zero watermark has nothing to call or notify, or if the task
+     to notify is not a task. */
+  SYSASSERT(((zero == bytes_) || (ISNOTNULLPTR(callback_)) || (ISNOTNULLPTR(task_))) && ((ISNULLPTR(task_)) || (RETURN_SUCCESS == __TaskCheck__(task_))));
+
+
+  /* Check that a non-zero watermark has something to call or notify and that
+     the task to notify, if there is one, is a task. */
+  if (((zero == bytes_) || (ISNOTNULLPTR(callback_)) || (ISNOTNULLPTR(task_))) && ((ISNULLPTR(task_)) || (RETURN_SUCCESS == __TaskCheck__(task_)))) {
+
+
+    DISABLE_INTERRUPTS();
+
+    region_->watermarkBytes = bytes_;
+
+    region_->watermarkCallback = callback_;
+
+    region_->watermarkTask = task_;
+
+    region_->watermarkTripped = false;
+
+    ENABLE_INTERRUPTS();
+
+    ret = RETURN_SUCCESS;
+  }
+
+
+  return ret;
+}
+
+
+
+/* Called by __calloc__() when a memory region crosses its watermark to call the
+   watermark callback and notify the watermark task. */
+static void __MemoryRegionWatermark__(volatile MemoryRegion_t *region_) {
+
+
+  Char_t notification[CONFIG_NOTIFICATION_VALUE_BYTES];
+
+
+  if (ISNOTNULLPTR(region_->watermarkCallback)) {
+
+    (*region_->watermarkCallback)(region_->freeBlocks * CONFIG_MEMORY_REGION_BLOCK_SIZE);
+  }
+
+
+  if (ISNOTNULLPTR(region_->watermarkTask)) {
+
+
+    __memset__(notification, zero, CONFIG_NOTIFICATION_VALUE_BYTES);
+
+    notification[0] = region_->watermarkNotification;
+
+
+    /* If the task already has a notification waiting, xTaskNotifyGive() will
+       leave it in place. */
+    xTaskNotifyGive(region_->watermarkTask, 0x1u, notification);
+  }
+
+
+  return;
+}
+
+
+
+/* The __MemoryWatermarkDetach__() function is called by xTaskDelete() to clear the watermark
+   task of either memory region if it is the task being deleted, so a later crossing does
+   not notify a freed task. */
+void __MemoryWatermarkDetach__(const Task_t *task_) {
+
+
+  DISABLE_INTERRUPTS();
+
+
+  if (task_ == heap.watermarkTask) {
+
+    heap.watermarkTask = NULL;
+  }
+
+
+  if (task_ == kernel.watermarkTask) {
+
+    kernel.watermarkTask = NULL;
+  }
+
+
+  ENABLE_INTERRUPTS();
+
+
+  return;
+}
+
+
+
+/* The xMemHandleAlloc() system call allocates movable memory from the heap memory region
+   and returns a handle to it. The kernel may move the memory whenever the handle is
+   not locked so the address must be obtained with xMemHandleLock(). The first bytes
+   of the allocation store a pointer back to the handle so the kernel can update the
+   handle when the memory is moved. */
+MemoryHandle_t *xMemHandleAlloc(const Size_t size_) {
+
+
+  MemoryHandle_t *ret = NULL;
+
+  MemoryHandle_t **addr = NULL;
+
+  MemoryEntry_t *entry = NULL;
+
+
+  /* Assert if zero bytes are requested. */
+  SYSASSERT(zero < size_);
+
+
+  if (zero < size_) {
+
+
+    ret = (MemoryHandle_t *)__KernelAllocateMemory__(sizeof(MemoryHandle_t));
+
+
+    /* Assert if the handle could not be allocated. */
+    SYSASSERT(ISNOTNULLPTR(ret));
+
+
+    if (ISNOTNULLPTR(ret)) {
+
+
+      /* Check if the heap has a large enough free entry before calling __calloc__()
+         so a fragmented heap can be compacted first rather than failing. */
+      if (sizeof(MemoryHandle_t *) + size_ > __MemoryRegionLargestFree__(&heap)) {
+
+        xMemCompact();
+      }
+
+
+      addr = (MemoryHandle_t **)__calloc__(&heap, sizeof(MemoryHandle_t *) + size_);
+
+
+      /* Assert if the movable memory could not be allocated. */
+      SYSASSERT(ISNOTNULLPTR(addr));
+
+
+      if (ISNOTNULLPTR(addr)) {
+
+
+        DISABLE_INTERRUPTS();
+
+
+        /* Store the back pointer to the handle and mark the entry movable
+           so __MemoryRegionCompact__() is allowed to slide it. */
+        *addr = ret;
+
+        entry = ADDR2ENTRY(addr, &heap);
+
+        entry->movable = true;
+
+        heap.movableEntries++;
+
+        ret->addr = (Addr_t *)(addr + 1);
+
+        ret->locks = zero;
+
+        ENABLE_INTERRUPTS();
+
+      } else {
+
+
+        __KernelFreeMemory__(ret);
+
+        ret = NULL;
+      }
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xMemHandleFree() system call frees the memory allocated by xMemHandleAlloc()
+   along with the handle itself. */
+void xMemHandleFree(MemoryHandle_t *handle_) {
+
+
+  /* Assert if the handle is not a valid kernel object. */
+  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(handle_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+
+
+  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(handle_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
+
+
+    /* The heap address includes the back pointer to the handle. */
+    __free__(&heap, (MemoryHandle_t **)handle_->addr - 1);
+
+    __KernelFreeMemory__(handle_);
+  }
+
+
+  return;
+}
+
+
+
+/* The xMemHandleLock() system call locks the memory referenced by a handle in place
+   and returns its address. The address is valid until the handle is unlocked. Locks
+   nest so the handle must be unlocked once for each time it was locked. */
+Addr_t *xMemHandleLock(MemoryHandle_t *handle_) {
+
+
+  Addr_t *ret = NULL;
+
+
+  /* Assert if the handle is not a valid kernel object. */
+  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(handle_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+
+
+  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(handle_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
+
+
+    DISABLE_INTERRUPTS();
+
+    handle_->locks++;
+
+    ret = handle_->addr;
+
+    ENABLE_INTERRUPTS();
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xMemHandleUnlock() system call releases a lock taken by xMemHandleLock(). Once
+   all of the locks are released the kernel may move the memory again. */
+void xMemHandleUnlock(MemoryHandle_t *handle_) {
+
+
+  /* Assert if the handle is not a valid kernel object. */
+  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(handle_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+
+
+  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(handle_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
+
+
+    /* Assert if the handle isn't locked. */
+    SYSASSERT(zero < handle_->locks);
+
+
+    if (zero < handle_->locks) {
+
+      DISABLE_INTERRUPTS();
+
+      handle_->locks--;
+
+      /* Now that the memory is unlocked it may be possible to move it. */
+      heap.compactable = true;
+
+      ENABLE_INTERRUPTS();
+    }
+  }
+
+
+  return;
+}
+
+
+
+/* The xMemCompact() system call compacts the heap memory region by sliding
+   all unlocked movable memory toward the start of the heap until no more
+   memory can be moved. */
+void xMemCompact(void) {
+
+
+  while (RETURN_SUCCESS == __MemoryRegionCompact__(&heap)) {
+    /* Keep going until there is nothing left to move. */
+  }
+
+
+  return;
+}
+
+
+
+/* A wrapper function for __MemoryRegionCompact__() because the memory
+   regions cannot be accessed outside the scope of mem.c. The scheduler
+   calls this when it is idle so it only moves one allocation at a time. */
+Base_t __HeapCompactMemory__(void) {
+
+
+  return __MemoryRegionCompact__(&heap);
+}
+
+
+
+/* Slide the first unlocked movable entry that follows a free entry down into
+   the free entry. The free blocks end up after the moved entry where they are
+   merged with any free entry that follows. Returns RETURN_SUCCESS if an entry
+   was moved. */
+static Base_t __MemoryRegionCompact__(volatile MemoryRegion_t *region_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  MemoryEntry_t *cursor = NULL;
+
+  MemoryEntry_t *after = NULL;
+
+  MemoryHandle_t *handle = NULL;
+
+  HalfWord_t freeBlocks = zero;
+
+  HalfWord_t moveBlocks = zero;
+
+
+  /* Don't bother walking the memory region if there is nothing that can be moved or
+     nothing has been freed or unlocked since the last time nothing could be moved. */
+  if ((zero < region_->movableEntries) && (true == region_->compactable) && (false == SYSFLAG_FAULT())) {
+
+
+    DISABLE_INTERRUPTS();
+
+
+    /* Assert if the memory region fails its consistency check. */
+    SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheck__(region_, NULL, MEMORY_REGION_CHECK_OPTION_WO_ADDR));
+
+
+    if (RETURN_SUCCESS == __MemoryRegionCheck__(region_, NULL, MEMORY_REGION_CHECK_OPTION_WO_ADDR)) {
+
+      cursor = region_->start;
+
+
+      while ((ISNOTNULLPTR(cursor)) && (ISNOTNULLPTR(cursor->next)) && (RETURN_FAILURE == ret)) {
+
+
+        if ((true == cursor->free) && (false == cursor->next->free) && (true == cursor->next->movable)) {
+
+
+          handle = *((MemoryHandle_t **)ENTRY2ADDR(cursor->next, region_));
+
+
+          /* Locked memory stays where it is. */
+          if (zero == handle->locks) {
+
+
+            freeBlocks = cursor->blocks;
+
+            moveBlocks = cursor->next->blocks;
+
+            after = cursor->next->next;
+
+
+            /* Copy the movable entry, including its memory entry, down to the free
+               entry. The destination is below the source so the ascending copy done
+               by __memcpy__() is safe even though the two overlap. */
+            __memcpy__(cursor, cursor->next, moveBlocks * CONFIG_MEMORY_REGION_BLOCK_SIZE);
+
+
+            /* The free blocks now follow the moved entry. */
+            cursor->next = (MemoryEntry_t *)((Byte_t *)cursor + (moveBlocks * CONFIG_MEMORY_REGION_BLOCK_SIZE));
+
+            cursor->next->free = true;
+
+            cursor->next->movable = false;
+
+            cursor->next->blocks = freeBlocks;
+
+            cursor->next->slack = zero;
+
+            cursor->next->next = after;
+
+
+            /* Point the handle at the new address, skipping over the back pointer. */
+            handle->addr = (Addr_t *)((MemoryHandle_t **)ENTRY2ADDR(cursor, region_) + 1);
+
+            ret = RETURN_SUCCESS;
+          }
+        }
+
+
+        cursor = cursor->next;
+      }
+
+
+      /* Merge the free blocks with a free entry that may follow them. */
+      if (RETURN_SUCCESS == ret) {
+
+        __DefragMemoryRegion__(region_);
+
+      } else {
+
+        region_->compactable = false;
+      }
+    }
+
+
+    ENABLE_INTERRUPTS();
+  }
+
+
+  return ret;
+}
+
+
+
+/* Return the size in bytes of the largest free entry in a memory region. */
+static Size_t __MemoryRegionLargestFree__(const volatile MemoryRegion_t *region_) {
+
+
+  Size_t ret = zero;
+
+  MemoryEntry_t *cursor = NULL;
+
+
+  cursor = region_->start;
+
+
+  while (ISNOTNULLPTR(cursor)) {
+
+
+    if ((true == cursor->free) && (ret < ((Size_t)(cursor->blocks - region_->entrySize) * CONFIG_MEMORY_REGION_BLOCK_SIZE))) {
+
+      ret = (Size_t)(cursor->blocks - region_->entrySize) * CONFIG_MEMORY_REGION_BLOCK_SIZE;
+    }
+
+
+    cursor = cursor->next;
+  }
+
+
+  return ret;
+}
+
+
+
 /* Return the memory region statistics for the specified memory region. */
 static MemoryRegionStats_t *__MemGetRegionStats__(const volatile MemoryRegion_t *region_) {
 
@@ -864,6 +1529,8 @@ static MemoryRegionStats_t *__MemGetRegionStats__(const volatile MemoryRegion_t
 
   MemoryRegionStats_t *ret = NULL;
 
+  Base_t i = zero;
+
 
   /* We can't do anything if the region_ pointer is null so assert if it is. */
   SYSASSERT(ISNOTNULLPTR(region_));
@@ -916,6 +1583,11 @@ static MemoryRegionStats_t *__MemGetRegionStats__(const volatile MemoryRegion_t
              successfulAllocations;
              successfulFrees;
              minimumEverFreeBytesRemaining;
+             externalFragmentationPercent;
+             requestedBytesInUse;
+             grantedBytesInUse;
+             freeEntryHistogram[];
+             sizeClassAllocations[];
            */
 
           /* Clear the structure to make sure everything is zero. */
@@ -966,6 +1638,31 @@ static MemoryRegionStats_t *__MemGetRegionStats__(const volatile MemoryRegion_t
             /* Move on to the next entry. */
             cursor = cursor->next;
           }
+
+
+          /* The external fragmentation is the share of the free memory that is NOT
+             in the largest free entry (i.e., zero when all free memory is contiguous). */
+          if (zero < ret->availableSpaceInBytes) {
+
+            ret->externalFragmentationPercent = 100u - ((ret->largestFreeEntryInBytes * 100u) / ret->availableSpaceInBytes);
+          }
+
+
+          /* The requested and granted bytes are maintained by __calloc__() and __free__()
+             so the difference between the two is the internal fragmentation. */
+          ret->requestedBytesInUse = region_->requestedBytes;
+
+          ret->grantedBytesInUse = region_->grantedBytes;
+
+
+          /* The histograms are also maintained by __calloc__() and __free__() so
+             just copy them. */
+          for (i = zero; i < MEMORY_REGION_HISTOGRAM_BUCKETS; i++) {
+
+            ret->freeEntryHistogram[i] = region_->freeEntryHistogram[i];
+
+            ret->sizeClassAllocations[i] = region_->sizeClassAllocations[i];
+          }
         }
       }
     }
@@ -976,7 +1673,7 @@ static MemoryRegionStats_t *__MemGetRegionStats__(const volatile MemoryRegion_t
 
 
 /* Defrag an entire memory region to reduce memory fragmentation. */
-static void __DefragMemoryRegion__(const volatile MemoryRegion_t *region_) {
+static void __DefragMemoryRegion__(volatile MemoryRegion_t *region_) {
 
 
   MemoryEntry_t *cursor = NULL;
@@ -1021,10 +1718,19 @@ static void __DefragMemoryRegion__(const volatile MemoryRegion_t *region_) {
           if ((ISNOTNULLPTR(cursor)) && (ISNOTNULLPTR(cursor->next)) && (true == cursor->free) && (true == cursor->next->free)) {
 
 
+            /* The two free entries become one so update the free entry histogram. */
+            region_->freeEntryHistogram[__MemoryRegionBucket__(cursor->blocks)]--;
+
+            region_->freeEntryHistogram[__MemoryRegionBucket__(cursor->next->blocks)]--;
+
+
             /* Add the blocks from the subsequent entry to the
                current entry. */
             cursor->blocks += cursor->next->blocks;
 
+
+            region_->freeEntryHistogram[__MemoryRegionBucket__(cursor->blocks)]++;
+
             /* Just drop the "next" entry just as you would in a linked list. */
             cursor->next = cursor->next->next;
 
@@ -1045,6 +1751,29 @@ static void __DefragMemoryRegion__(const volatile MemoryRegion_t *region_) {
 
 
 
+/* Return the histogram bucket for a number of blocks. The bucket is the
+   integer log2 of the blocks so it takes at most 16 shifts to find. */
+static Base_t __MemoryRegionBucket__(const HalfWord_t blocks_) {
+
+
+  Base_t ret = zero;
+
+  HalfWord_t blocks = blocks_;
+
+
+  while (1u < blocks) {
+
+    blocks >>= 1u;
+
+    ret++;
+  }
+
+
+  return ret;
+}
+
+
+
 #if defined(POSIX_ARCH_OTHER)
 
 void __MemoryClear__(void) {
@@ -1054,10 +1783,14 @@ void __MemoryClear__(void) {
 
   heap.minAvailableEver = CONFIG_MEMORY_REGION_SIZE_IN_BLOCKS * CONFIG_MEMORY_REGION_BLOCK_SIZE;
 
+  heap.watermarkNotification = MEMORY_WATERMARK_HEAP_NOTIFICATION;
+
   __memset__(&kernel, 0x0, sizeof(MemoryRegion_t));
 
   kernel.minAvailableEver = CONFIG_MEMORY_REGION_SIZE_IN_BLOCKS * CONFIG_MEMORY_REGION_BLOCK_SIZE;
 
+  kernel.watermarkNotification = MEMORY_WATERMARK_KERNEL_NOTIFICATION;
+
   return;
 }
 
@@ -57,6 +57,15 @@ Base_t __memcmp__(const volatile Addr_t *s1_, const volatile Addr_t *s2_, const
 void __MemoryInit__(void);
 MemoryRegionStats_t *xMemGetHeapStats(void);
 MemoryRegionStats_t *xMemGetKernelStats(void);
+Base_t xMemSetHeapWatermark(const Size_t bytes_, void (*callback_)(const Size_t available_), Task_t *task_);
+Base_t xMemSetKernelWatermark(const Size_t bytes_, void (*callback_)(const Size_t available_), Task_t *task_);
+void __MemoryWatermarkDetach__(const Task_t *task_);
+MemoryHandle_t *xMemHandleAlloc(const Size_t size_);
+void xMemHandleFree(MemoryHandle_t *handle_);
+Addr_t *xMemHandleLock(MemoryHandle_t *handle_);
+void xMemHandleUnlock(MemoryHandle_t *handle_);
+void xMemCompact(void);
+Base_t __HeapCompactMemory__(void);
 
 #if defined(POSIX_ARCH_OTHER)
 void __MemoryClear__(void);
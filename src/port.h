@@ -82,6 +82,8 @@ extern unsigned long timer0_overflow_count;
 
 #define ENABLE_INTERRUPTS() __asm__ __volatile__ ("sei")
 
+#define MEMORY_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+
 #elif defined(ARDUINO_ARCH_SAM)
 
 /*
@@ -125,6 +127,8 @@ extern uint32_t GetTickCount(void);
 
 #define ENABLE_INTERRUPTS() __asm volatile ("cpsie i")
 
+#define MEMORY_BARRIER() __asm volatile ("dmb" ::: "memory")
+
 #elif defined(ARDUINO_ARCH_SAMD) /* TESTED 2022-03-24 */
 
 /*
@@ -156,6 +160,8 @@ extern unsigned long millis(void);
 
 #define ENABLE_INTERRUPTS() __asm volatile ("cpsie i")
 
+#define MEMORY_BARRIER() __asm volatile ("dmb" ::: "memory")
+
 #elif defined(ARDUINO_ARCH_ESP8266) /* TESTED 2022-08-22 */
 
 /*
@@ -179,6 +185,8 @@ extern void yield(void);
 
 #define ENABLE_INTERRUPTS() xt_rsil(0)
 
+#define MEMORY_BARRIER() __asm__ __volatile__ ("memw" ::: "memory")
+
 #elif defined(ARDUINO_TEENSY_MICROMOD) || defined(ARDUINO_TEENSY40) || defined(ARDUINO_TEENSY41) || defined(ARDUINO_TEENSY36) || defined(ARDUINO_TEENSY35) || defined(ARDUINO_TEENSY31) || defined(ARDUINO_TEENSY32) || defined(ARDUINO_TEENSY30) || defined(ARDUINO_TEENSYLC) /* TESTED 2022-03-24 */
 
 /*
@@ -215,6 +223,8 @@ extern uint32_t systick_millis_count;
 
 #define ENABLE_INTERRUPTS() __asm volatile ("cpsie i")
 
+#define MEMORY_BARRIER() __asm volatile ("dmb" ::: "memory")
+
 #elif defined(ESP32)
 
 #pragma message("WARNING: The ESP32 Arduino core uses FreeRTOS. HeliOS and FreeRTOS cannot coexist in the same application. If your application requires an embedded operating system, use the built-in FreeRTOS included with the ESP32 Arduino core.")
@@ -223,6 +233,8 @@ extern uint32_t systick_millis_count;
 
 #define ENABLE_INTERRUPTS()
 
+#define MEMORY_BARRIER() __sync_synchronize()
+
 #elif defined(CMSIS_ARCH_CORTEXM) /* TESTED 2022-03-24 */
 
 /* ld linker script section
@@ -258,6 +270,8 @@ extern uint32_t systick_millis_count;
 
 #define ENABLE_INTERRUPTS() __enable_irq()
 
+#define MEMORY_BARRIER() __DMB()
+
 #define SYSTEM_CORE_CLOCK_FREQUENCY 0xF42400u /* 16000000u */
 
 #define SYSTEM_CORE_CLOCK_PRESCALER 0x3E8u /* 1000u */
@@ -273,12 +287,23 @@ extern uint32_t systick_millis_count;
 
 #define ENABLE_INTERRUPTS()
 
+#define MEMORY_BARRIER() __sync_synchronize()
+
 #define CONFIG_SYSTEM_ASSERT_BEHAVIOR(f, l) printf("kernel: assert at %s:%d\n", f, l )
 
 #endif
 
 
 
+/* A port that does not define a memory barrier is assumed to be a single core
+   that does not reorder memory accesses, so only the compiler must be stopped
+   from reordering them. */
+#if !defined(MEMORY_BARRIER)
+#define MEMORY_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+#endif
+
+
+
 #ifdef __cplusplus
 extern "C" {
 #endif
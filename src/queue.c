@@ -26,30 +26,195 @@
 #include "queue.h"
 
 static void __QueueDropmessage__(Queue_t *queue_);
+static void __QueueAdvance__(Queue_t *queue_, const Base_t received_);
 static QueueMessage_t *__QueuePeek__(const Queue_t *queue_);
+static Base_t __QueueCheck__(const Queue_t *queue_);
+#if defined(CONFIG_ENABLE_QUEUE_AUDIT)
+static Base_t __QueueAudit__(const Queue_t *queue_);
+#endif
+static Queue_t *__QueueCreate__(const Base_t limit_, const Base_t messageBytes_, const Size_t size_, const Base_t variable_, const Base_t priority_, const Base_t overwrite_);
+static Base_t __QueueSend__(Queue_t *queue_, const Base_t priority_, const Base_t messageBytes_, const Char_t *messageValue_);
+static Message_t *__QueueHead__(const Queue_t *queue_);
+static Message_t *__QueueSlot__(const Queue_t *queue_, const Base_t slot_);
+static Base_t *__QueueLink__(const Queue_t *queue_, const Base_t slot_);
+static Base_t __QueueHighestPriority__(const Queue_t *queue_);
+static Size_t __QueueRecordBytes__(const Queue_t *queue_, const Base_t messageBytes_);
+static Base_t __QueueRoom__(const Queue_t *queue_, const Size_t recordBytes_, Size_t *offset_);
+static Message_t *__QueueReserve__(Queue_t *queue_, const Base_t messageBytes_, const Base_t priority_);
+static void __QueueNotify__(Queue_t *queue_, const Base_t previousLength_);
+static Base_t __QueueSetCheck__(const QueueSet_t *set_);
+static Base_t __TopicCheck__(const Topic_t *topic_);
+static void __TopicDrain__(Queue_t *queue_);
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+static void __QueueStatsEnqueue__(Queue_t *queue_, Message_t *message_);
+static void __QueueStatsDequeue__(Queue_t *queue_, const Message_t *message_, const Base_t received_);
+#endif
+
 
 /* The xQueueCreate() system call creates a message queue for inter-task
    communication. */
 Queue_t *xQueueCreate(Base_t limit_) {
 
 
+  return __QueueCreate__(limit_, CONFIG_MESSAGE_VALUE_BYTES, limit_ * QUEUE_RECORD_BYTES(CONFIG_MESSAGE_VALUE_BYTES), false, false, false);
+}
+
+
+
+/* The xQueueCreateEx() system call creates a message queue whose messages can be up
+   to the specified number of bytes rather than CONFIG_MESSAGE_VALUE_BYTES. */
+Queue_t *xQueueCreateEx(const Base_t limit_, const Base_t messageBytes_) {
+
+
+  Queue_t *ret = NULL;
+
+
+  /* Assert if the end-user passed zero message bytes. */
+  SYSASSERT(zero < messageBytes_);
+
+
+  /* Check if the message bytes is greater than zero, if not head
+     toward the exit. */
+  if (zero < messageBytes_) {
+
+
+    ret = __QueueCreate__(limit_, messageBytes_, limit_ * QUEUE_RECORD_BYTES(messageBytes_), false, false, false);
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xQueueCreateVariable() system call creates a message queue backed by a ring of the
+   specified number of bytes where each message only occupies as many bytes as its value
+   needs. */
+Queue_t *xQueueCreateVariable(const Base_t limit_, const Size_t bytes_) {
+
+
+  Queue_t *ret = NULL;
+
+  Size_t size = zero;
+
+  /* Intentionally underflow an unsigned data type
+     to get its maximum value. */
+  Base_t messageBytes = -1;
+
+
+  /* Round the ring down to a whole number of message headers so a header always
+     fits wherever the tail lands. */
+  size = (bytes_ / sizeof(Message_t)) * sizeof(Message_t);
+
+
+  /* Assert if the ring is too small to hold a message with at least one byte. */
+  SYSASSERT(QUEUE_RECORD_BYTES(1u) <= size);
+
+
+  /* Check if the ring is large enough to hold a message with at least one byte,
+     if not head toward the exit. */
+  if (QUEUE_RECORD_BYTES(1u) <= size) {
+
+
+    /* The largest message is the one that fills the entire ring, unless that
+       is more than a message can describe. */
+    if ((size - sizeof(Message_t)) < (Size_t)messageBytes) {
+
+      messageBytes = (Base_t)(size - sizeof(Message_t));
+    }
+
+
+    ret = __QueueCreate__(limit_, messageBytes, size, true, false, false);
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xQueueCreatePriority() system call creates a message queue where each message has a
+   priority and the highest priority, oldest message is always received first. */
+Queue_t *xQueueCreatePriority(const Base_t limit_, const Base_t messageBytes_) {
+
+
+  Queue_t *ret = NULL;
+
+
+  /* Assert if the end-user passed zero message bytes. */
+  SYSASSERT(zero < messageBytes_);
+
+
+  /* Check if the message bytes is greater than zero, if not head
+     toward the exit. */
+  if (zero < messageBytes_) {
+
+
+    ret = __QueueCreate__(limit_, messageBytes_, limit_ * QUEUE_RECORD_BYTES(messageBytes_), false, true, false);
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xQueueCreateMailbox() system call creates a message queue that never refuses a message.
+   Sending to a full mailbox overwrites its oldest message so only the newest messages are kept. */
+Queue_t *xQueueCreateMailbox(const Base_t limit_, const Base_t messageBytes_) {
+
+
+  Queue_t *ret = NULL;
+
+
+  /* Assert if the end-user passed zero message bytes. */
+  SYSASSERT(zero < messageBytes_);
+
+
+  /* Check if the message bytes is greater than zero, if not head
+     toward the exit. */
+  if (zero < messageBytes_) {
+
+
+    ret = __QueueCreate__(limit_, messageBytes_, limit_ * QUEUE_RECORD_BYTES(messageBytes_), false, false, true);
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __QueueCreate__() function allocates a queue and the ring that holds its
+   messages. */
+static Queue_t *__QueueCreate__(const Base_t limit_, const Base_t messageBytes_, const Size_t size_, const Base_t variable_, const Base_t priority_, const Base_t overwrite_) {
+
+
   Queue_t *ret = NULL;
 
+  Base_t i = zero;
+
 
   /* Assert if the end-user attempted to create a queue with a limit
-     that is less than the configured minimum limit. */
-  SYSASSERT(CONFIG_QUEUE_MINIMUM_LIMIT <= limit_);
+     that is less than the configured minimum limit or a priority queue
+     with a limit that collides with the slot list terminator. A mailbox
+     only needs room for its latest message. */
+  SYSASSERT(((CONFIG_QUEUE_MINIMUM_LIMIT <= limit_) || ((true == overwrite_) && (zero < limit_))) && ((false == priority_) || (QUEUE_SLOT_NONE > limit_)));
 
 
   /* Check if the end-user attempted to create a queue with a limit
      that is less than the configured minimum limit, if they did then
      just head toward the exit. */
-  if (CONFIG_QUEUE_MINIMUM_LIMIT <= limit_) {
+  if (((CONFIG_QUEUE_MINIMUM_LIMIT <= limit_) || ((true == overwrite_) && (zero < limit_))) && ((false == priority_) || (QUEUE_SLOT_NONE > limit_))) {
 
 
 
 
-    ret = (Queue_t *)__KernelAllocateMemory__(sizeof(Queue_t));
+    /* Allocate the queue and its ring of messages together so
+       sending and receiving never have to touch the kernel memory
+       region again. The ring begins immediately after the queue. A
+       priority queue also needs one link per slot after the ring. */
+    ret = (Queue_t *)__KernelAllocateMemory__(sizeof(Queue_t) + size_ + ((true == priority_) ? (Size_t) limit_ : zero));
 
 
     /* Assert if xMemAlloc() didn't return our requested
@@ -68,9 +233,70 @@ Queue_t *xQueueCreate(Base_t limit_) {
 
       ret->locked = false;
 
-      ret->head = NULL;
+      ret->variable = variable_;
+
+      ret->priority = priority_;
+
+      ret->overwrite = overwrite_;
+
+      ret->messageBytes = messageBytes_;
+
+      ret->sequence = zero;
+
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+
+      __memset__(&ret->stats, zero, sizeof(QueueStats_t));
+
+      /* Intentionally underflow an unsigned data type
+         to get its maximum value. */
+      ret->stats.minimumLatency = -1;
+
+      ret->totalLatency = zero;
+
+#endif
 
-      ret->tail = NULL;
+      ret->size = size_;
+
+      ret->head = zero;
+
+      ret->tail = zero;
+
+      ret->messages = (Byte_t *)(ret + 1);
+
+      ret->set = NULL;
+
+      ret->waiter = NULL;
+
+      ret->topic = NULL;
+
+      ret->priorityMap = zero;
+
+      ret->freeSlot = QUEUE_SLOT_NONE;
+
+
+      for (i = zero; i < QUEUE_PRIORITY_LEVELS; i++) {
+
+        ret->priorityHeads[i] = QUEUE_SLOT_NONE;
+
+        ret->priorityTails[i] = QUEUE_SLOT_NONE;
+      }
+
+
+      /* A priority queue's ring is a pool of fixed size slots. Chain every
+         slot onto the free list. */
+      if (true == priority_) {
+
+
+        ret->freeSlot = zero;
+
+
+        for (i = zero; i < limit_; i++) {
+
+          *__QueueLink__(ret, i) = i + 1u;
+        }
+
+        *__QueueLink__(ret, limit_ - 1u) = QUEUE_SLOT_NONE;
+      }
     }
   }
 
@@ -84,27 +310,42 @@ void xQueueDelete(Queue_t *queue_) {
 
   /* Assert if the heap fails its health check or if the queue pointer the end-user
      passed is invalid. */
-  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
 
 
 
   /* Check if the heap is health and the queue pointer the end-user passed is valid.
      If so, continue. Otherwise, head toward the exit. */
-  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
+  if (RETURN_SUCCESS == __QueueCheck__(queue_)) {
+
 
+    /* If the queue is a member of a queue set, take it out of the set
+       so the set is not left holding a freed queue. */
+    if (ISNOTNULLPTR(queue_->set)) {
+
+      xQueueSetRemove(queue_->set, queue_);
+    }
 
-    /* If the queue contains messages, traverse the queue and drop the
-       messages as we go. */
-    while (ISNOTNULLPTR(queue_->head)) {
 
+    /* If the queue subscribes to a topic, unsubscribe it so the topic
+       is not left holding a freed queue and the references the queue
+       holds are released. */
+    if (ISNOTNULLPTR(queue_->topic)) {
 
-      /* Drop the next message in the queue. */
-      xQueueDropMessage(queue_);
+      xTopicUnsubscribe(queue_->topic, queue_);
     }
 
 
+    /* Release a task waiting on the queue so it doesn't point at a
+       freed queue. */
+    if (ISNOTNULLPTR(queue_->waiter)) {
+
+      __TaskWaitDetach__(queue_->waiter);
+    }
 
 
+    /* The message slots were allocated with the queue so freeing the
+       queue frees any messages it still contains. */
     __KernelFreeMemory__(queue_);
   }
 
@@ -122,41 +363,26 @@ Base_t xQueueGetLength(const Queue_t *queue_) {
 
   Base_t ret = zero;
 
-  Base_t messages = zero;
-
-  Message_t *cursor = NULL;
 
   /* Assert if the heap fails its health check or if the queue pointer the end-user
      passed is invalid. */
-  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
 
 
   /* Check if the heap is health and the queue pointer the end-user passed is valid.
      If so, continue. Otherwise, head toward the exit. */
-  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
-
-
-    cursor = queue_->head;
-
-    /* Traverse the queue and count the number of messages it contains. */
-    while (ISNOTNULLPTR(cursor)) {
-
-      messages++;
-
-      cursor = cursor->next;
-    }
+  if (RETURN_SUCCESS == __QueueCheck__(queue_)) {
 
 
-    /* Assert if the number of messages we counted disagrees with the queue's
-       length. This could indicate a problem. */
-    SYSASSERT(messages == queue_->length);
+    /* Assert if the queue's length exceeds its limit. This could indicate
+       a problem. */
+    SYSASSERT(queue_->limit >= queue_->length);
 
 
-    /* Check if the number of messages we counted agrees with the queue's
-       length. */
-    if (messages == queue_->length) {
+    /* Check if the queue's length is within its limit. */
+    if (queue_->limit >= queue_->length) {
 
-      ret = messages;
+      ret = queue_->length;
     }
   }
 
@@ -175,42 +401,26 @@ Base_t xQueueIsQueueEmpty(const Queue_t *queue_) {
 
   Base_t ret = false;
 
-  Base_t messages = zero;
-
-  Message_t *cursor = NULL;
 
 
   /* Assert if the heap fails its health check or if the queue pointer the end-user
      passed is invalid. */
-  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
 
 
   /* Check if the heap is health and the queue pointer the end-user passed is valid.
      If so, continue. Otherwise, head toward the exit. */
-  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
-
-
-    cursor = queue_->head;
-
-    /* Traverse the queue and count the number of messages it contains. */
-    while (ISNOTNULLPTR(cursor)) {
-
-
-      messages++;
-
-      cursor = cursor->next;
-    }
+  if (RETURN_SUCCESS == __QueueCheck__(queue_)) {
 
 
+    /* Assert if the queue's length exceeds its limit. This could indicate
+       a problem. */
+    SYSASSERT(queue_->limit >= queue_->length);
 
-    /* Assert if the number of messages we counted disagrees with the queue's
-       length. This could indicate a problem. */
-    SYSASSERT(messages = queue_->length);
 
-
-    /* Check if the number of messages we counted agrees with the queue's
-       length. Also, for the queue to be empty there must be zero messages. */
-    if ((zero == messages) && (messages == queue_->length)) {
+    /* Check if the queue's length is within its limit. Also, for the
+       queue to be empty there must be zero messages. */
+    if ((zero == queue_->length) && (queue_->limit >= queue_->length)) {
 
       ret = true;
     }
@@ -230,41 +440,27 @@ Base_t xQueueIsQueueFull(const Queue_t *queue_) {
 
   Base_t ret = false;
 
-  Base_t messages = zero;
+  Size_t offset = zero;
 
-  Message_t *cursor = NULL;
 
 
   /* Assert if the heap fails its health check or if the queue pointer the end-user
      passed is invalid. */
-  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
 
 
   /* Check if the heap is health and the queue pointer the end-user passed is valid.
      If so, continue. Otherwise, head toward the exit. */
-  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
-
-    cursor = queue_->head;
-
-
-
-    /* Traverse the queue and count the number of messages it contains. */
-    while (ISNOTNULLPTR(cursor)) {
-
-      messages++;
-
-      cursor = cursor->next;
-    }
+  if (RETURN_SUCCESS == __QueueCheck__(queue_)) {
 
+    /* Assert if the queue's length exceeds its limit. This could indicate
+       a problem. */
+    SYSASSERT(queue_->limit >= queue_->length);
 
-    /* Assert if the number of messages we counted disagrees with the queue's
-       length. This could indicate a problem. */
-    SYSASSERT(messages == queue_->length);
 
-    /* Check if the number of messages we counted agrees with the queue's
-       length. Also, for the queue to be full the number of messages must be
-       equal to the queue limit. */
-    if ((messages >= queue_->limit) && (messages == queue_->length)) {
+    /* Check if the queue's length is equal to its limit or if the ring does not
+       have room for even the smallest message, if so the queue is full. */
+    if ((queue_->limit == queue_->length) || (false == __QueueRoom__(queue_, __QueueRecordBytes__(queue_, 1u), &offset))) {
 
 
       ret = true;
@@ -285,41 +481,26 @@ Base_t xQueueMessagesWaiting(const Queue_t *queue_) {
 
   Base_t ret = false;
 
-  Base_t messages = zero;
-
-  Message_t *cursor = NULL;
 
 
   /* Assert if the heap fails its health check or if the queue pointer the end-user
      passed is invalid. */
-  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
 
 
 
   /* Check if the heap is health and the queue pointer the end-user passed is valid.
      If so, continue. Otherwise, head toward the exit. */
-  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
-
-    cursor = queue_->head;
+  if (RETURN_SUCCESS == __QueueCheck__(queue_)) {
 
-    /* Traverse the queue and count the number of messages it contains. */
-    while (ISNOTNULLPTR(cursor)) {
+    /* Assert if the queue's length exceeds its limit. This could indicate
+       a problem. */
+    SYSASSERT(queue_->limit >= queue_->length);
 
-      messages++;
-
-      cursor = cursor->next;
-    }
-
-
-    /* Assert if the number of messages we counted disagrees with the queue's
-       length. This could indicate a problem. */
-    SYSASSERT(messages == queue_->length);
 
-
-    /* Check if the number of messages we counted agrees with the queue's
-       length. Also, for there to be waiting messages look to make sure the
-       count is greater than zero. */
-    if ((zero < messages) && (messages == queue_->length)) {
+    /* Check if the queue's length is within its limit. Also, for there to
+       be waiting messages look to make sure the length is greater than zero. */
+    if ((zero < queue_->length) && (queue_->limit >= queue_->length)) {
 
 
       ret = true;
@@ -338,14 +519,29 @@ Base_t xQueueMessagesWaiting(const Queue_t *queue_) {
 Base_t xQueueSend(Queue_t *queue_, const Base_t messageBytes_, const Char_t *messageValue_) {
 
 
+  return __QueueSend__(queue_, zero, messageBytes_, messageValue_);
+}
+
+
+
+/* The xQueueSendPriority() system call will send a message with the specified priority to the
+   queue. If the queue is not a priority queue, the priority is ignored. */
+Base_t xQueueSendPriority(Queue_t *queue_, const Base_t priority_, const Base_t messageBytes_, const Char_t *messageValue_) {
+
+
+  return __QueueSend__(queue_, priority_, messageBytes_, messageValue_);
+}
+
+
+
+static Base_t __QueueSend__(Queue_t *queue_, const Base_t priority_, const Base_t messageBytes_, const Char_t *messageValue_) {
+
+
 
   Base_t ret = RETURN_FAILURE;
 
   Message_t *message = NULL;
 
-  Base_t messages = zero;
-
-  Message_t *cursor = NULL;
 
 
   /* Assert if the end-user passed zero message bytes. A message
@@ -353,9 +549,8 @@ Base_t xQueueSend(Queue_t *queue_, const Base_t messageBytes_, const Char_t *mes
   SYSASSERT(zero < messageBytes_);
 
 
-  /* Assert if the end-user passed a number of message bytes that
-     exceeds the size of the message value. */
-  SYSASSERT(CONFIG_MESSAGE_VALUE_BYTES >= messageBytes_);
+  /* Assert if the end-user passed a priority that is out of range. */
+  SYSASSERT(QUEUE_PRIORITY_LEVELS > priority_);
 
 
   /* Assert if the end-user passed a null pointer for the message
@@ -363,220 +558,489 @@ Base_t xQueueSend(Queue_t *queue_, const Base_t messageBytes_, const Char_t *mes
   SYSASSERT(ISNOTNULLPTR(messageValue_));
 
   /* Assert if the user passed an invalid queue. */
-  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
 
 
   /* Check if the message bytes is within parameters and the message value is not null. */
-  if ((RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) && (zero < messageBytes_) && (CONFIG_MESSAGE_VALUE_BYTES >= messageBytes_) && (ISNOTNULLPTR(messageValue_))) {
+  if ((RETURN_SUCCESS == __QueueCheck__(queue_)) && (zero < messageBytes_) && (QUEUE_PRIORITY_LEVELS > priority_) && (ISNOTNULLPTR(messageValue_))) {
 
 
-    /* Assert if the queue is locked (locked queues can not SEND messages). */
-    SYSASSERT(false == queue_->locked);
+    /* Assert if the end-user passed a number of message bytes that
+       exceeds the largest message the queue can hold. */
+    SYSASSERT(queue_->messageBytes >= messageBytes_);
 
 
-    /* check to make sure queue is NOT locked (locked queues can not SEND messages). */
-    if (false == queue_->locked) {
+    /* Assert if the queue is locked (locked queues can not SEND messages) or subscribes
+       to a topic (only xTopicPublish() can send to a subscribed queue). */
+    SYSASSERT((false == queue_->locked) && (ISNULLPTR(queue_->topic)));
 
-      /* Assert if the heap fails its health check or if the queue pointer the end-user
-         passed is invalid. */
-      SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
 
-      /* Check if the heap is health and the queue pointer the end-user passed is valid.
-         If so, continue. Otherwise, head toward the exit. */
-      if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
+    /* check to make sure queue is NOT locked (locked queues can not SEND messages), does
+       not subscribe to a topic and the message is not larger than the largest message
+       the queue can hold. */
+    if ((false == queue_->locked) && (ISNULLPTR(queue_->topic)) && (queue_->messageBytes >= messageBytes_)) {
 
-        cursor = queue_->head;
 
-        /* If the queue has a head, iterate through the queue and count the number of messages. */
-        while (ISNOTNULLPTR(cursor)) {
+      message = __QueueReserve__(queue_, messageBytes_, priority_);
 
-          messages++;
 
-          cursor = cursor->next;
-        }
+      /* Assert if the queue is full. */
+      SYSASSERT(ISNOTNULLPTR(message));
+
+
+      /* Check if the queue had room for the message, if so copy the message
+         value in right behind its header. */
+      if (ISNOTNULLPTR(message)) {
 
 
-        /* Assert if the queue is full. */
-        SYSASSERT(queue_->limit > queue_->length);
+        __memcpy__(message + 1, messageValue_, messageBytes_);
 
+        ret = RETURN_SUCCESS;
+      }
+    }
+  }
 
-        /* Assert if the messages counted disagrees with the queue length. If
-           so there is a problem. */
-        SYSASSERT(messages == queue_->length);
+  return ret;
+}
 
 
-        /* Check if the queue is not full and that the messages counted agrees with the
-           queue length. */
-        if ((queue_->limit > queue_->length) && (messages == queue_->length)) {
+/* The xQueueSendBatch() system call will send several messages to the queue at once. The queue
+   is validated once for the whole batch and the messages are copied into the ring back to back.
+   It returns the number of messages sent. */
+Base_t xQueueSendBatch(Queue_t *queue_, const Base_t count_, const QueueMessage_t *messages_, const Base_t mode_) {
 
 
 
+  Base_t ret = zero;
 
-          message = (Message_t *)__KernelAllocateMemory__(sizeof(Message_t));
+  Base_t i = zero;
 
+  Message_t *message = NULL;
 
-          /* Assert if xMemAlloc() did not allocate our requested memory. */
-          SYSASSERT(ISNOTNULLPTR(message));
+  Size_t head = zero;
 
-          /* Check if the message was successfully allocated by xMemAlloc(). */
-          if (ISNOTNULLPTR(message)) {
+  Size_t tail = zero;
 
-            message->messageBytes = messageBytes_;
+  Base_t length = zero;
 
-            __memcpy__(message->messageValue, messageValue_, CONFIG_MESSAGE_VALUE_BYTES);
+  Word_t sequence = zero;
 
-            message->next = NULL;
+  Base_t count = count_;
 
-            /* If the queue tail is not null then it already contains messages and append the new message, otherwise
-               set the head and tail to the new message. */
-            if (ISNOTNULLPTR(queue_->tail)) {
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+  Base_t highWater = zero;
+#endif
 
-              queue_->tail->next = message;
 
-              queue_->tail = message;
 
-            } else {
+  /* Assert if the end-user passed a null pointer for the messages or
+     an invalid mode. */
+  SYSASSERT(ISNOTNULLPTR(messages_) && ((QUEUE_BATCH_ALL_OR_NOTHING == mode_) || (QUEUE_BATCH_BEST_EFFORT == mode_)));
 
-              queue_->head = message;
+  /* Assert if the user passed an invalid queue. */
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
 
-              queue_->tail = message;
-            }
 
-            queue_->length++;
+  /* Check if the queue is valid, the messages are not null and the mode is valid. */
+  if ((RETURN_SUCCESS == __QueueCheck__(queue_)) && ISNOTNULLPTR(messages_) && ((QUEUE_BATCH_ALL_OR_NOTHING == mode_) || (QUEUE_BATCH_BEST_EFFORT == mode_))) {
 
-            ret = RETURN_SUCCESS;
-          }
-        }
-      }
-    }
-  }
 
-  return ret;
-}
+    /* Assert if the queue is locked (locked queues can not SEND messages) or subscribes
+       to a topic (only xTopicPublish() can send to a subscribed queue). */
+    SYSASSERT((false == queue_->locked) && (ISNULLPTR(queue_->topic)));
 
 
-/* The xQueuePeek() system call will return the next message in the queue without
-   dropping the message. */
-QueueMessage_t *xQueuePeek(const Queue_t *queue_) {
+    /* check to make sure queue is NOT locked (locked queues can not SEND messages) and
+       does not subscribe to a topic. */
+    if ((false == queue_->locked) && (ISNULLPTR(queue_->topic))) {
 
-  return __QueuePeek__(queue_);
-}
 
+      /* Remember the state of the ring so an all or nothing batch that does
+         not fit can be rolled back. Messages written past the saved tail sit
+         in free space so restoring the tail discards them. */
+      head = queue_->head;
 
-static QueueMessage_t *__QueuePeek__(const Queue_t *queue_) {
-  QueueMessage_t *ret = NULL;
+      tail = queue_->tail;
 
+      length = queue_->length;
 
-  /* Assert if the heap fails its health check or if the queue pointer the end-user
-     passed is invalid. */
-  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+      sequence = queue_->sequence;
 
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+      highWater = queue_->stats.highWater;
+#endif
 
-  /* Check if the heap is health and the queue pointer the end-user passed is valid.
-     If so, continue. Otherwise, head toward the exit. */
-  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
 
-    /* If the head is not null, then there is a message waiting for us to
-       peek at. */
-    if (ISNOTNULLPTR(queue_->head)) {
+      /* A priority queue's slots can't be rolled back like the ring, but every
+         message occupies exactly one slot so whether an all or nothing batch
+         fits is known before anything is sent. A mailbox can't be rolled back
+         either because sending may have overwritten its oldest messages, but
+         it never runs out of room so only the message sizes need checking. */
+      if (((true == queue_->priority) || (true == queue_->overwrite)) && (QUEUE_BATCH_ALL_OR_NOTHING == mode_)) {
 
 
-      ret = (QueueMessage_t *)__HeapAllocateMemory__(sizeof(QueueMessage_t));
+        if ((true == queue_->priority) && ((queue_->limit - queue_->length) < count_)) {
 
+          count = zero;
+        }
 
-      /* Assert if xMemAlloc() didn't do its job. */
-      SYSASSERT(ISNOTNULLPTR(ret));
 
-      /* If xMemAlloc() allocated the heap memory then copy the message into the
-         queue message we will return. Otherwise, head toward the exit. */
-      if (ISNOTNULLPTR(ret)) {
+        for (i = zero; i < count; i++) {
 
 
-        ret->messageBytes = queue_->head->messageBytes;
+          if ((zero == messages_[i].messageBytes) || (CONFIG_MESSAGE_VALUE_BYTES < messages_[i].messageBytes) || (queue_->messageBytes < messages_[i].messageBytes)) {
 
-        __memcpy__(ret->messageValue, queue_->head->messageValue, CONFIG_MESSAGE_VALUE_BYTES);
+            count = zero;
+          }
+        }
       }
-    }
-  }
 
 
-  return ret;
-}
+      for (i = zero; i < count; i++) {
 
-/* The xQueueDropMessage() system call will drop the next message from the queue without
-   returning the message. */
-void xQueueDropMessage(Queue_t *queue_) {
 
-  __QueueDropmessage__(queue_);
+        /* Stop at the first message whose size is out of range. */
+        if ((zero == messages_[i].messageBytes) || (CONFIG_MESSAGE_VALUE_BYTES < messages_[i].messageBytes) || (queue_->messageBytes < messages_[i].messageBytes)) {
 
-  return;
-}
+          break;
+        }
 
-static void __QueueDropmessage__(Queue_t *queue_) {
 
+        message = __QueueReserve__(queue_, messages_[i].messageBytes, zero);
 
-  Message_t *message = NULL;
 
+        /* Stop at the first message that does not fit. */
+        if (ISNULLPTR(message)) {
 
+          break;
+        }
 
-  /* Assert if the heap fails its health check or if the queue pointer the end-user
-     passed is invalid. */
-  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
 
+        __memcpy__(message + 1, messages_[i].messageValue, messages_[i].messageBytes);
 
+        ret++;
+      }
 
-  /* Check if the heap is health and the queue pointer the end-user passed is valid.
-     If so, continue. Otherwise, head toward the exit. */
-  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
 
+      /* If not every message was sent and the batch is all or nothing, roll
+         the ring back to how it was. */
+      if ((ret < count_) && (QUEUE_BATCH_ALL_OR_NOTHING == mode_) && (false == queue_->priority) && (false == queue_->overwrite)) {
 
 
-    /* Check if there is a message in the queue, if there isn't then
-       we have nothing to drop so head toward the exit. */
-    if (ISNOTNULLPTR(queue_->head)) {
+        queue_->head = head;
 
+        queue_->tail = tail;
 
-      message = queue_->head;
+        queue_->sequence = sequence;
 
-      queue_->head = queue_->head->next;
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+        queue_->stats.enqueued -= ret;
 
+        queue_->stats.highWater = highWater;
+#endif
 
-      /* If the head is now null, then let's set the tail to null
-         too because the queue is now empty. */
-      if (ISNULLPTR(queue_->head)) {
 
-        queue_->tail = NULL;
-      }
+        /* Restore the length through __QueueNotify__() so the queue's set
+           sees the queue go back to empty. */
+        i = queue_->length;
 
-      queue_->length--;
+        queue_->length = length;
 
+        __QueueNotify__(queue_, i);
 
-      __KernelFreeMemory__(message);
+        ret = zero;
+      }
     }
   }
 
-
-  return;
+  return ret;
 }
 
-/* The xQueueReceive() system call will return the next message in the queue and drop
-   it from the queue. */
-QueueMessage_t *xQueueReceive(Queue_t *queue_) {
 
 
-  QueueMessage_t *ret = NULL;
+/* The xQueueReceiveBatch() system call will receive up to the specified number of messages
+   from the queue into the end-user's array of queue messages. It returns the number of
+   messages received. */
+Base_t xQueueReceiveBatch(Queue_t *queue_, const Base_t max_, QueueMessage_t *messages_) {
 
 
+  Base_t ret = zero;
+
+  Message_t *message = NULL;
+
+
+
+  /* Assert if the end-user passed a null pointer for the messages. */
+  SYSASSERT(ISNOTNULLPTR(messages_));
+
 
   /* Assert if the heap fails its health check or if the queue pointer the end-user
      passed is invalid. */
-  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
+
+
+
+  /* Assert if the queue subscribes to a topic, its messages must be received
+     with xTopicReceive() so their references are released. */
+  SYSASSERT((RETURN_SUCCESS != __QueueCheck__(queue_)) || (ISNULLPTR(queue_->topic)));
+
+
+
+  /* Check if the heap is health and the queue pointer the end-user passed is valid
+     and the messages are not null. If so, continue. Otherwise, head toward the exit. */
+  if ((RETURN_SUCCESS == __QueueCheck__(queue_)) && ISNOTNULLPTR(messages_) && (ISNULLPTR(queue_->topic))) {
+
+
+    /* Receive messages until the end-user's array is full or the queue is
+       empty. */
+    while ((ret < max_) && (zero < queue_->length)) {
+
+
+      message = __QueueHead__(queue_);
+
+
+      /* Stop at a message that is too large to fit in a queue message, it is
+         left in the queue. */
+      if (CONFIG_MESSAGE_VALUE_BYTES < message->messageBytes) {
+
+        break;
+      }
+
+
+      messages_[ret].messageBytes = message->messageBytes;
+
+      __memcpy__(messages_[ret].messageValue, message + 1, message->messageBytes);
+
+      __QueueAdvance__(queue_, true);
+
+      ret++;
+    }
+  }
+
+
+  return ret;
+}
 
 
+/* The xQueuePeek() system call will return the next message in the queue without
+   dropping the message. */
+QueueMessage_t *xQueuePeek(const Queue_t *queue_) {
+
+  return __QueuePeek__(queue_);
+}
+
+
+static QueueMessage_t *__QueuePeek__(const Queue_t *queue_) {
+  QueueMessage_t *ret = NULL;
+
+  Message_t *message = NULL;
+
+
+  /* Assert if the heap fails its health check or if the queue pointer the end-user
+     passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
+
 
   /* Check if the heap is health and the queue pointer the end-user passed is valid.
      If so, continue. Otherwise, head toward the exit. */
-  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
+  if (RETURN_SUCCESS == __QueueCheck__(queue_)) {
+
+    /* If the length is greater than zero, then there is a message waiting
+       for us to peek at the head of the ring. */
+    if (zero < queue_->length) {
+
+
+      message = __QueueHead__(queue_);
+
+
+      /* Assert if the message is too large to fit in a queue message. Messages
+         larger than CONFIG_MESSAGE_VALUE_BYTES must be received with
+         xQueueReceiveBytes(). */
+      SYSASSERT(CONFIG_MESSAGE_VALUE_BYTES >= message->messageBytes);
+
+
+      /* Check if the message will fit in a queue message. */
+      if (CONFIG_MESSAGE_VALUE_BYTES >= message->messageBytes) {
+
+
+        ret = (QueueMessage_t *)__HeapAllocateMemory__(sizeof(QueueMessage_t));
+
+
+        /* Assert if xMemAlloc() didn't do its job. */
+        SYSASSERT(ISNOTNULLPTR(ret));
+
+        /* If xMemAlloc() allocated the heap memory then copy the message into the
+           queue message we will return. Otherwise, head toward the exit. */
+        if (ISNOTNULLPTR(ret)) {
+
+
+          ret->messageBytes = message->messageBytes;
+
+          __memcpy__(ret->messageValue, message + 1, message->messageBytes);
+        }
+      }
+    }
+  }
+
+
+  return ret;
+}
+
+/* The xQueueDropMessage() system call will drop the next message from the queue without
+   returning the message. */
+void xQueueDropMessage(Queue_t *queue_) {
+
+  __QueueDropmessage__(queue_);
+
+  return;
+}
+
+static void __QueueDropmessage__(Queue_t *queue_) {
+
+
+
+  /* Assert if the heap fails its health check or if the queue pointer the end-user
+     passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
+
+
+
+  /* Assert if the queue subscribes to a topic, its messages must be received
+     with xTopicReceive() so their references are released. */
+  SYSASSERT((RETURN_SUCCESS != __QueueCheck__(queue_)) || (ISNULLPTR(queue_->topic)));
+
+
+
+  /* Check if the heap is health and the queue pointer the end-user passed is valid
+     and does not subscribe to a topic. If so, continue. Otherwise, head toward the exit. */
+  if ((RETURN_SUCCESS == __QueueCheck__(queue_)) && (ISNULLPTR(queue_->topic))) {
+
+
+    __QueueAdvance__(queue_, true);
+  }
+
+
+  return;
+}
+
+
+
+/* The __QueueAdvance__() function drops the message at the head of the queue. It does
+   not validate the queue so the caller must have already done so. The received parameter
+   is false when a mailbox drops a message to make room rather than a task receiving it. */
+static void __QueueAdvance__(Queue_t *queue_, const Base_t received_) {
+
+
+  Message_t *message = NULL;
+
+  Base_t priority = zero;
+
+  Base_t slot = zero;
+
+
+
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+
+  if (zero < queue_->length) {
+
+    __QueueStatsDequeue__(queue_, __QueueHead__(queue_), received_);
+  }
+
+#endif
+
+
+  /* Check if there is a message in the priority queue, if there is then
+     unlink the oldest message of the highest priority and return its slot
+     to the free list. */
+  if ((true == queue_->priority) && (zero < queue_->length)) {
+
+
+    priority = __QueueHighestPriority__(queue_);
+
+    slot = queue_->priorityHeads[priority];
+
+    queue_->priorityHeads[priority] = *__QueueLink__(queue_, slot);
+
+
+    /* If that was the last message of its priority, clear the priority's
+       bit so it is skipped. */
+    if (QUEUE_SLOT_NONE == *__QueueLink__(queue_, slot)) {
+
+      queue_->priorityTails[priority] = QUEUE_SLOT_NONE;
+
+      queue_->priorityMap &= (Base_t) ~(1u << priority);
+    }
+
+    *__QueueLink__(queue_, slot) = queue_->freeSlot;
+
+    queue_->freeSlot = slot;
+
+    queue_->length--;
+
+    __QueueNotify__(queue_, queue_->length + 1u);
+
+
+    /* Check if there is a message in the queue, if there isn't then
+       we have nothing to drop so head toward the exit. */
+  } else if (zero < queue_->length) {
+
+
+    message = __QueueHead__(queue_);
+
+
+    /* Dropping a message only requires advancing the head past the
+       message. */
+    queue_->head += __QueueRecordBytes__(queue_, message->messageBytes);
+
+    queue_->length--;
+
+    __QueueNotify__(queue_, queue_->length + 1u);
+
+
+    /* If the queue is now empty, rewind the ring so the next message
+       starts at the beginning of it. Otherwise, if the head reached the
+       end of the ring or a wrap marker left by __QueueReserve__(), the
+       next message is at the beginning of the ring. */
+    if (zero == queue_->length) {
+
+      queue_->head = zero;
+
+      queue_->tail = zero;
+
+    } else if ((queue_->size <= queue_->head) || (zero == ((Message_t *)&queue_->messages[queue_->head])->messageBytes)) {
+
+      queue_->head = zero;
+    }
+  }
+
+
+  return;
+}
+
+/* The xQueueReceive() system call will return the next message in the queue and drop
+   it from the queue. */
+QueueMessage_t *xQueueReceive(Queue_t *queue_) {
+
+
+  QueueMessage_t *ret = NULL;
+
+
+
+  /* Assert if the heap fails its health check or if the queue pointer the end-user
+     passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
+
+
+
+  /* Assert if the queue subscribes to a topic, its messages must be received
+     with xTopicReceive() so their references are released. */
+  SYSASSERT((RETURN_SUCCESS != __QueueCheck__(queue_)) || (ISNULLPTR(queue_->topic)));
+
+
+
+  /* Check if the heap is health and the queue pointer the end-user passed is valid
+     and does not subscribe to a topic. If so, continue. Otherwise, head toward the exit. */
+  if ((RETURN_SUCCESS == __QueueCheck__(queue_)) && (ISNULLPTR(queue_->topic))) {
 
 
     /* Re-use some code and peek to see if there is a message
@@ -602,51 +1066,1843 @@ QueueMessage_t *xQueueReceive(Queue_t *queue_) {
 }
 
 
-/* The xQueueLockQueue() system call will LOCK the queue and prevent xQueueSend() from
-   sending a message to the queue. */
-void xQueueLockQueue(Queue_t *queue_) {
+/* The xQueueReceiveInto() system call will copy the next message in the queue into the
+   end-user's queue message and drop it from the queue. Unlike xQueueReceive(), no heap
+   memory is allocated. */
+Base_t xQueueReceiveInto(Queue_t *queue_, QueueMessage_t *message_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Message_t *message = NULL;
+
+
+
+  /* Assert if the end-user passed a null pointer for the queue message. */
+  SYSASSERT(ISNOTNULLPTR(message_));
 
 
   /* Assert if the heap fails its health check or if the queue pointer the end-user
      passed is invalid. */
-  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
 
 
 
-  /* Check if the heap is health and the queue pointer the end-user passed is valid.
-     If so, continue. Otherwise, head toward the exit. */
-  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
+  /* Assert if the queue subscribes to a topic, its messages must be received
+     with xTopicReceive() so their references are released. */
+  SYSASSERT((RETURN_SUCCESS != __QueueCheck__(queue_)) || (ISNULLPTR(queue_->topic)));
 
-    SYSASSERT(false == queue_->locked);
 
-    queue_->locked = true;
+
+  /* Check if the heap is health and the queue pointer the end-user passed is valid,
+     does not subscribe to a topic and the queue message is not null. If so, continue.
+     Otherwise, head toward the exit. */
+  if ((RETURN_SUCCESS == __QueueCheck__(queue_)) && ISNOTNULLPTR(message_) && (ISNULLPTR(queue_->topic))) {
+
+
+    /* Check if there is a message in the queue, if there isn't then
+       we have nothing to receive so head toward the exit. */
+    if (zero < queue_->length) {
+
+
+      message = __QueueHead__(queue_);
+
+
+      /* Assert if the message is too large to fit in a queue message. */
+      SYSASSERT(CONFIG_MESSAGE_VALUE_BYTES >= message->messageBytes);
+
+
+      /* Check if the message will fit in a queue message. If it won't,
+         leave the message in the queue. */
+      if (CONFIG_MESSAGE_VALUE_BYTES >= message->messageBytes) {
+
+
+        message_->messageBytes = message->messageBytes;
+
+        __memcpy__(message_->messageValue, message + 1, message->messageBytes);
+
+        __QueueAdvance__(queue_, true);
+
+        ret = RETURN_SUCCESS;
+      }
+    }
   }
 
 
-  return;
+  return ret;
 }
 
 
-/* The xQueueUnLockQueue() system call will UNLOCK the queue and allow xQueueSend() to
-   send a message to the queue. */
-void xQueueUnLockQueue(Queue_t *queue_) {
+
+/* The xQueueReceiveSequence() system call will receive the next message in the queue like
+   xQueueReceiveInto() and return its sequence number. Messages are numbered in the order they
+   are sent, so a gap in the sequence numbers tells the receiver how many messages a mailbox
+   overwrote before they were received. */
+Base_t xQueueReceiveSequence(Queue_t *queue_, QueueMessage_t *message_, Word_t *sequence_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Word_t sequence = zero;
+
+
+  /* Assert if the end-user passed a null pointer for the sequence number. */
+  SYSASSERT(ISNOTNULLPTR(sequence_));
+
+
+  /* Assert if the queue pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
+
+
+  /* Check if the sequence number is not null and the queue pointer is valid. A
+     priority queue does not receive messages in the order they were sent so
+     its messages can't be numbered. */
+  if ((ISNOTNULLPTR(sequence_)) && (RETURN_SUCCESS == __QueueCheck__(queue_)) && (false == queue_->priority)) {
+
+
+    /* The messages waiting in the queue are the last ones sent so the
+       message at the head was numbered length - 1 messages ago. */
+    sequence = queue_->sequence - queue_->length + 1u;
+
+
+    if (RETURN_SUCCESS == xQueueReceiveInto(queue_, message_)) {
+
+
+      *sequence_ = sequence;
+
+      ret = RETURN_SUCCESS;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xQueuePeekRef() system call will return a pointer to the value of the next message
+   in the queue without copying or dropping the message. The pointer refers to the queue's
+   own storage and is only valid until the queue is next changed. */
+const Char_t *xQueuePeekRef(const Queue_t *queue_, Base_t *messageBytes_) {
+
+
+  const Char_t *ret = NULL;
+
+  Message_t *message = NULL;
+
+
+
+  /* Assert if the end-user passed a null pointer for the message bytes. */
+  SYSASSERT(ISNOTNULLPTR(messageBytes_));
 
 
   /* Assert if the heap fails its health check or if the queue pointer the end-user
      passed is invalid. */
-  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
 
 
 
-  /* Check if the heap is health and the queue pointer the end-user passed is valid.
-     If so, continue. Otherwise, head toward the exit. */
-  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
+  /* Check if the heap is health and the queue pointer the end-user passed is valid
+     and the message bytes is not null. If so, continue. Otherwise, head toward the exit. */
+  if ((RETURN_SUCCESS == __QueueCheck__(queue_)) && ISNOTNULLPTR(messageBytes_)) {
 
-    SYSASSERT(true == queue_->locked);
 
-    queue_->locked = false;
+    /* Check if there is a message in the queue, if there is then return
+       a pointer to its value, which sits right behind its header. */
+    if (zero < queue_->length) {
+
+
+      message = __QueueHead__(queue_);
+
+      *messageBytes_ = message->messageBytes;
+
+      ret = (const Char_t *)(message + 1);
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xQueueReceiveBytes() system call will copy the next message in the queue into the buffer
+   and drop it from the queue. It returns the number of bytes in the message. */
+Base_t xQueueReceiveBytes(Queue_t *queue_, const Base_t bufferBytes_, Char_t *buffer_) {
+
+
+  Base_t ret = zero;
+
+  Message_t *message = NULL;
+
+
+
+  /* Assert if the end-user passed a null pointer for the buffer. */
+  SYSASSERT(ISNOTNULLPTR(buffer_));
+
+
+  /* Assert if the heap fails its health check or if the queue pointer the end-user
+     passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
+
+
+
+  /* Assert if the queue subscribes to a topic, its messages must be received
+     with xTopicReceive() so their references are released. */
+  SYSASSERT((RETURN_SUCCESS != __QueueCheck__(queue_)) || (ISNULLPTR(queue_->topic)));
+
+
+
+  /* Check if the heap is health and the queue pointer the end-user passed is valid,
+     does not subscribe to a topic and the buffer is not null. If so, continue.
+     Otherwise, head toward the exit. */
+  if ((RETURN_SUCCESS == __QueueCheck__(queue_)) && ISNOTNULLPTR(buffer_) && (ISNULLPTR(queue_->topic))) {
+
+
+    /* Check if there is a message in the queue, if there isn't then
+       we have nothing to receive so head toward the exit. */
+    if (zero < queue_->length) {
+
+
+      message = __QueueHead__(queue_);
+
+
+      /* Assert if the message is larger than the end-user's buffer. */
+      SYSASSERT(bufferBytes_ >= message->messageBytes);
+
+
+      /* Check if the message will fit in the end-user's buffer. If it won't,
+         leave the message in the queue. */
+      if (bufferBytes_ >= message->messageBytes) {
+
+
+        ret = message->messageBytes;
+
+        __memcpy__(buffer_, message + 1, message->messageBytes);
+
+        __QueueAdvance__(queue_, true);
+      }
+    }
+  }
+
+
+  return ret;
+}
+
+
+/* The xQueueLockQueue() system call will LOCK the queue and prevent xQueueSend() from
+   sending a message to the queue. */
+void xQueueLockQueue(Queue_t *queue_) {
+
+
+  /* Assert if the heap fails its health check or if the queue pointer the end-user
+     passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
+
+
+
+  /* Check if the heap is health and the queue pointer the end-user passed is valid.
+     If so, continue. Otherwise, head toward the exit. */
+  if (RETURN_SUCCESS == __QueueCheck__(queue_)) {
+
+    SYSASSERT(false == queue_->locked);
+
+    queue_->locked = true;
+  }
+
+
+  return;
+}
+
+
+/* The xQueueUnLockQueue() system call will UNLOCK the queue and allow xQueueSend() to
+   send a message to the queue. */
+void xQueueUnLockQueue(Queue_t *queue_) {
+
+
+  /* Assert if the heap fails its health check or if the queue pointer the end-user
+     passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
+
+
+
+  /* Check if the heap is health and the queue pointer the end-user passed is valid.
+     If so, continue. Otherwise, head toward the exit. */
+  if (RETURN_SUCCESS == __QueueCheck__(queue_)) {
+
+    SYSASSERT(true == queue_->locked);
+
+    queue_->locked = false;
+  }
+
+
+  return;
+}
+
+
+
+/* The xSPSCQueueCreate() system call creates a single-producer, single-consumer queue. One
+   more slot than the limit is allocated so a full queue can be told apart from an empty one
+   by the head and tail alone. */
+SPSCQueue_t *xSPSCQueueCreate(const Base_t limit_, const Base_t messageBytes_) {
+
+
+  SPSCQueue_t *ret = NULL;
+
+
+  /* Assert if the end-user attempted to create a queue with a limit that is less than
+     the configured minimum limit, a limit that leaves no room for the extra slot or a
+     message size that is zero or larger than a queue message. */
+  SYSASSERT((CONFIG_QUEUE_MINIMUM_LIMIT <= limit_) && ((Base_t)(limit_ + 1u) > limit_) && (zero < messageBytes_) && (CONFIG_MESSAGE_VALUE_BYTES >= messageBytes_));
+
+
+  /* Check if the limit and message size are valid, if not head toward
+     the exit. */
+  if ((CONFIG_QUEUE_MINIMUM_LIMIT <= limit_) && ((Base_t)(limit_ + 1u) > limit_) && (zero < messageBytes_) && (CONFIG_MESSAGE_VALUE_BYTES >= messageBytes_)) {
+
+
+    ret = (SPSCQueue_t *)__KernelAllocateMemory__(sizeof(SPSCQueue_t) + ((limit_ + 1u) * QUEUE_RECORD_BYTES(messageBytes_)));
+
+
+    /* Assert if xMemAlloc() didn't return our requested
+       kernel memory. */
+    SYSASSERT(ISNOTNULLPTR(ret));
+
+
+    /* Check if xMemAlloc() returned our requested
+       kernel memory. */
+    if (ISNOTNULLPTR(ret)) {
+
+
+      ret->head = zero;
+
+      ret->tail = zero;
+
+      ret->slots = limit_ + 1u;
+
+      ret->messageBytes = messageBytes_;
+
+      ret->recordBytes = QUEUE_RECORD_BYTES(messageBytes_);
+
+      ret->messages = (Byte_t *)(ret + 1);
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xSPSCQueueDelete() system call will delete a single-producer, single-consumer queue. */
+void xSPSCQueueDelete(SPSCQueue_t *queue_) {
+
+
+  /* Assert if the heap fails its health check or if the queue pointer the end-user
+     passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+
+
+  /* Check if the heap is health and the queue pointer the end-user passed is valid.
+     If so, continue. Otherwise, head toward the exit. */
+  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
+
+
+    __KernelFreeMemory__(queue_);
   }
 
 
   return;
 }
+
+
+
+/* The xSPSCQueueSend() system call will send a message to a single-producer, single-consumer
+   queue. It is safe to call from an interrupt handler. Only the producer writes the tail and
+   only the consumer writes the head, and each fits in a single Base_t, so neither side needs
+   to disable interrupts. The queue is NOT validated against the kernel memory region because
+   that walk is neither bounded nor safe while a task is modifying the region. */
+Base_t xSPSCQueueSend(SPSCQueue_t *queue_, const Base_t messageBytes_, const Char_t *messageValue_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Base_t tail = zero;
+
+  Base_t next = zero;
+
+  Message_t *message = NULL;
+
+
+  /* Check if the queue and message value are not null and the message size is
+     within parameters. No assertions are made here because this may be called
+     from an interrupt handler. */
+  if (ISNOTNULLPTR(queue_) && ISNOTNULLPTR(messageValue_) && (zero < messageBytes_) && (queue_->messageBytes >= messageBytes_)) {
+
+
+    tail = queue_->tail;
+
+    next = tail + 1u;
+
+
+    if (queue_->slots <= next) {
+
+      next = zero;
+    }
+
+
+    /* The queue is full when advancing the tail would make it equal to the
+       head. */
+    if (next != queue_->head) {
+
+
+      message = (Message_t *)&queue_->messages[tail * queue_->recordBytes];
+
+      message->messageBytes = messageBytes_;
+
+      __memcpy__(message + 1, messageValue_, messageBytes_);
+
+
+      /* Make sure the message is visible to the consumer before the tail
+         that publishes it. */
+      MEMORY_BARRIER();
+
+      queue_->tail = next;
+
+      ret = RETURN_SUCCESS;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xSPSCQueueReceive() system call will copy the next message in a single-producer,
+   single-consumer queue into the end-user's queue message and drop it from the queue. */
+Base_t xSPSCQueueReceive(SPSCQueue_t *queue_, QueueMessage_t *message_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Base_t head = zero;
+
+  Message_t *message = NULL;
+
+
+  /* Check if the queue and queue message are not null. */
+  if (ISNOTNULLPTR(queue_) && ISNOTNULLPTR(message_)) {
+
+
+    head = queue_->head;
+
+
+    /* The queue is empty when the head is equal to the tail. */
+    if (head != queue_->tail) {
+
+
+      /* Make sure the message is not read before the tail that published
+         it. */
+      MEMORY_BARRIER();
+
+
+      message = (Message_t *)&queue_->messages[head * queue_->recordBytes];
+
+      message_->messageBytes = message->messageBytes;
+
+      __memcpy__(message_->messageValue, message + 1, message->messageBytes);
+
+
+      /* Make sure the message has been read before the slot is handed back
+         to the producer. */
+      MEMORY_BARRIER();
+
+      head++;
+
+
+      if (queue_->slots <= head) {
+
+        head = zero;
+      }
+
+      queue_->head = head;
+
+      ret = RETURN_SUCCESS;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xSPSCQueueGetLength() system call returns the number of messages in a single-producer,
+   single-consumer queue. The value is a snapshot and may already be stale if the other side
+   is running concurrently. */
+Base_t xSPSCQueueGetLength(const SPSCQueue_t *queue_) {
+
+
+  Base_t ret = zero;
+
+  Base_t head = zero;
+
+  Base_t tail = zero;
+
+
+  if (ISNOTNULLPTR(queue_)) {
+
+
+    head = queue_->head;
+
+    tail = queue_->tail;
+
+
+    if (tail >= head) {
+
+
+      ret = tail - head;
+
+    } else {
+
+
+      ret = queue_->slots - (head - tail);
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xQueueSetCreate() system call creates a queue set attached to a task. The scheduler
+   runs a waiting task whose queue set has a member queue with a message waiting, so the task
+   does not have to poll its queues. */
+QueueSet_t *xQueueSetCreate(Task_t *task_, const Base_t limit_) {
+
+
+  QueueSet_t *ret = NULL;
+
+  Base_t i = zero;
+
+
+  /* Assert if the end-user passed an invalid task, a task that already has a
+     queue set or a limit of zero. */
+  SYSASSERT((RETURN_SUCCESS == __TaskCheck__(task_)) && (ISNULLPTR(task_->queueSet)) && (zero < limit_));
+
+
+  /* Check if the task and limit are valid, if not head toward the exit. The task
+     is checked before its queue set is read. */
+  if ((RETURN_SUCCESS == __TaskCheck__(task_)) && (ISNULLPTR(task_->queueSet)) && (zero < limit_)) {
+
+
+    /* Allocate the set and its array of members together. The array
+       begins immediately after the set. */
+    ret = (QueueSet_t *)__KernelAllocateMemory__(sizeof(QueueSet_t) + (limit_ * sizeof(Queue_t *)));
+
+
+    /* Assert if xMemAlloc() didn't return our requested
+       kernel memory. */
+    SYSASSERT(ISNOTNULLPTR(ret));
+
+
+    /* Check if xMemAlloc() returned our requested
+       kernel memory. */
+    if (ISNOTNULLPTR(ret)) {
+
+
+      ret->task = task_;
+
+      ret->limit = limit_;
+
+      ret->ready = zero;
+
+      ret->cursor = zero;
+
+      ret->members = (Queue_t **)(ret + 1);
+
+
+      for (i = zero; i < limit_; i++) {
+
+        ret->members[i] = NULL;
+      }
+
+      task_->queueSet = ret;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xQueueSetDelete() system call will delete a queue set. The member queues are not
+   deleted, they are only taken out of the set. */
+void xQueueSetDelete(QueueSet_t *set_) {
+
+
+  Base_t i = zero;
+
+
+  /* Assert if the queue set pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __QueueSetCheck__(set_));
+
+
+  /* Check if the queue set pointer the end-user passed is valid. If so,
+     continue. Otherwise, head toward the exit. */
+  if (RETURN_SUCCESS == __QueueSetCheck__(set_)) {
+
+
+    for (i = zero; i < set_->limit; i++) {
+
+
+      if (ISNOTNULLPTR(set_->members[i])) {
+
+        set_->members[i]->set = NULL;
+      }
+    }
+
+
+    /* The task may have been deleted before the set. */
+    if (ISNOTNULLPTR(set_->task)) {
+
+      set_->task->queueSet = NULL;
+    }
+
+    __KernelFreeMemory__(set_);
+  }
+
+
+  return;
+}
+
+
+
+/* The xQueueSetAdd() system call adds a queue to a queue set. A queue can be a member of only
+   one queue set. */
+Base_t xQueueSetAdd(QueueSet_t *set_, Queue_t *queue_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Base_t i = zero;
+
+
+  /* Assert if the queue set or queue pointer the end-user passed is invalid. */
+  SYSASSERT((RETURN_SUCCESS == __QueueSetCheck__(set_)) && (RETURN_SUCCESS == __QueueCheck__(queue_)));
+
+
+  /* Check if the queue set and queue pointers are valid and the queue is not
+     already a member of a set. */
+  if ((RETURN_SUCCESS == __QueueSetCheck__(set_)) && (RETURN_SUCCESS == __QueueCheck__(queue_)) && (ISNULLPTR(queue_->set))) {
+
+
+    /* Look for an empty member. */
+    while ((i < set_->limit) && (ISNOTNULLPTR(set_->members[i]))) {
+
+      i++;
+    }
+
+
+    if (i < set_->limit) {
+
+
+      set_->members[i] = queue_;
+
+      queue_->set = set_;
+
+
+      /* A queue that already has messages waiting makes the set ready
+         straight away. */
+      if (zero < queue_->length) {
+
+        set_->ready++;
+      }
+
+      ret = RETURN_SUCCESS;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xQueueSetRemove() system call takes a queue out of a queue set. */
+Base_t xQueueSetRemove(QueueSet_t *set_, Queue_t *queue_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Base_t i = zero;
+
+
+  /* Assert if the queue set pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __QueueSetCheck__(set_));
+
+
+  /* Check if the queue set pointer is valid and the queue is a member of
+     it. The queue itself is not checked because xQueueDelete() calls this
+     with a queue it is about to free. */
+  if ((RETURN_SUCCESS == __QueueSetCheck__(set_)) && (ISNOTNULLPTR(queue_)) && (set_ == queue_->set)) {
+
+
+    for (i = zero; i < set_->limit; i++) {
+
+
+      if (queue_ == set_->members[i]) {
+
+
+        set_->members[i] = NULL;
+
+        queue_->set = NULL;
+
+
+        if (zero < queue_->length) {
+
+          set_->ready--;
+        }
+
+        ret = RETURN_SUCCESS;
+      }
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xQueueSetSelect() system call returns a member queue of the queue set that has a
+   message waiting or null if none do. The members are visited round robin so one busy
+   queue can't starve the others. Only the members' lengths are read so no member queue
+   is validated against the kernel memory region. */
+Queue_t *xQueueSetSelect(QueueSet_t *set_) {
+
+
+  Queue_t *ret = NULL;
+
+  Base_t i = zero;
+
+
+  /* Assert if the queue set pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __QueueSetCheck__(set_));
+
+
+  /* Check if the queue set pointer is valid and any member queue has a
+     message waiting. */
+  if ((RETURN_SUCCESS == __QueueSetCheck__(set_)) && (zero < set_->ready)) {
+
+
+    for (i = zero; (i < set_->limit) && (ISNULLPTR(ret)); i++) {
+
+
+      set_->cursor++;
+
+
+      if (set_->limit <= set_->cursor) {
+
+        set_->cursor = zero;
+      }
+
+
+      if ((ISNOTNULLPTR(set_->members[set_->cursor])) && (zero < set_->members[set_->cursor]->length)) {
+
+        ret = set_->members[set_->cursor];
+      }
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __QueueNotify__() function is called whenever a queue's length changes. If a task
+   is waiting on the queue, it is readied while the queue is not empty. If the queue is a
+   member of a queue set, the set's count of ready members is updated when the queue goes
+   from empty to not empty or back. */
+static void __QueueNotify__(Queue_t *queue_, const Base_t previousLength_) {
+
+
+  if (ISNOTNULLPTR(queue_->waiter)) {
+
+    queue_->waiter->waitReady = (zero < queue_->length) ? true : false;
+  }
+
+
+  if ((ISNOTNULLPTR(queue_->set)) && (zero == previousLength_) && (zero < queue_->length)) {
+
+
+    queue_->set->ready++;
+
+  } else if ((ISNOTNULLPTR(queue_->set)) && (zero < previousLength_) && (zero == queue_->length)) {
+
+
+    queue_->set->ready--;
+
+  } else {
+    /* Nothing to do here.. Just for MISRA C:2012 compliance. */
+  }
+
+
+  return;
+}
+
+
+
+/* The __QueueSetCheck__() function validates a queue set handle by checking its kernel
+   memory entry. */
+static Base_t __QueueSetCheck__(const QueueSet_t *set_) {
+
+
+  return __MemoryRegionCheckKernel__(set_, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK);
+}
+
+
+
+/* The xTopicCreate() system call creates a topic that up to the specified number of queues
+   can subscribe to. A message published to the topic is delivered to every subscriber
+   without being copied for each one. */
+Topic_t *xTopicCreate(const Base_t limit_) {
+
+
+  Topic_t *ret = NULL;
+
+  Base_t i = zero;
+
+
+  /* Assert if the end-user passed a limit of zero. */
+  SYSASSERT(zero < limit_);
+
+
+  /* Check if the limit is greater than zero, if not head toward the exit. */
+  if (zero < limit_) {
+
+
+    /* Allocate the topic and its array of subscribers together. The array
+       begins immediately after the topic. */
+    ret = (Topic_t *)__KernelAllocateMemory__(sizeof(Topic_t) + (limit_ * sizeof(Queue_t *)));
+
+
+    /* Assert if xMemAlloc() didn't return our requested
+       kernel memory. */
+    SYSASSERT(ISNOTNULLPTR(ret));
+
+
+    /* Check if xMemAlloc() returned our requested
+       kernel memory. */
+    if (ISNOTNULLPTR(ret)) {
+
+
+      ret->limit = limit_;
+
+      ret->subscribers = (Queue_t **)(ret + 1);
+
+
+      for (i = zero; i < limit_; i++) {
+
+        ret->subscribers[i] = NULL;
+      }
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xTopicDelete() system call will delete a topic. Every subscriber is unsubscribed first
+   so the references they hold are released. The subscriber queues are not deleted. */
+void xTopicDelete(Topic_t *topic_) {
+
+
+  Base_t i = zero;
+
+
+  /* Assert if the topic pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __TopicCheck__(topic_));
+
+
+  /* Check if the topic pointer the end-user passed is valid. If so,
+     continue. Otherwise, head toward the exit. */
+  if (RETURN_SUCCESS == __TopicCheck__(topic_)) {
+
+
+    for (i = zero; i < topic_->limit; i++) {
+
+
+      if (ISNOTNULLPTR(topic_->subscribers[i])) {
+
+        xTopicUnsubscribe(topic_, topic_->subscribers[i]);
+      }
+    }
+
+    __KernelFreeMemory__(topic_);
+  }
+
+
+  return;
+}
+
+
+
+/* The xTopicSubscribe() system call subscribes a queue to a topic. The queue receives a
+   reference to every message published to the topic from then on. A queue can subscribe
+   to only one topic and its messages must be large enough to hold a reference. */
+Base_t xTopicSubscribe(Topic_t *topic_, Queue_t *queue_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Base_t i = zero;
+
+
+  /* Assert if the topic or queue pointer the end-user passed is invalid. */
+  SYSASSERT((RETURN_SUCCESS == __TopicCheck__(topic_)) && (RETURN_SUCCESS == __QueueCheck__(queue_)));
+
+
+  /* Check if the topic and queue pointers are valid, the queue is not already
+     subscribed to a topic, is empty and its messages can hold a reference. Once
+     subscribed, only references are ever sent to the queue. */
+  if ((RETURN_SUCCESS == __TopicCheck__(topic_)) && (RETURN_SUCCESS == __QueueCheck__(queue_)) && (ISNULLPTR(queue_->topic)) && (zero == queue_->length) && (sizeof(TopicMessage_t *) <= queue_->messageBytes)) {
+
+
+    /* Look for an empty subscriber. */
+    while ((i < topic_->limit) && (ISNOTNULLPTR(topic_->subscribers[i]))) {
+
+      i++;
+    }
+
+
+    if (i < topic_->limit) {
+
+
+      topic_->subscribers[i] = queue_;
+
+      queue_->topic = topic_;
+
+      ret = RETURN_SUCCESS;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xTopicUnsubscribe() system call unsubscribes a queue from a topic. Any references still
+   waiting in the queue are released. */
+Base_t xTopicUnsubscribe(Topic_t *topic_, Queue_t *queue_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Base_t i = zero;
+
+
+  /* Assert if the topic pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __TopicCheck__(topic_));
+
+
+  /* Check if the topic pointer is valid and the queue subscribes to it. */
+  if ((RETURN_SUCCESS == __TopicCheck__(topic_)) && (ISNOTNULLPTR(queue_)) && (topic_ == queue_->topic)) {
+
+
+    for (i = zero; i < topic_->limit; i++) {
+
+
+      if (queue_ == topic_->subscribers[i]) {
+
+
+        topic_->subscribers[i] = NULL;
+
+        queue_->topic = NULL;
+
+        __TopicDrain__(queue_);
+
+        ret = RETURN_SUCCESS;
+      }
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xTopicPublish() system call publishes a message to a topic. The message value is copied
+   once into a reference counted message and only a reference is sent to each subscriber, so
+   the cost of publishing does not grow with the size of the message times the number of
+   subscribers. It returns the number of subscribers the message was delivered to. */
+Base_t xTopicPublish(Topic_t *topic_, const Size_t messageBytes_, const Byte_t *messageValue_) {
+
+
+  Base_t ret = zero;
+
+  Base_t i = zero;
+
+  TopicMessage_t *message = NULL;
+
+  Message_t *reference = NULL;
+
+
+  /* Assert if the end-user passed zero message bytes or a null message value. */
+  SYSASSERT((zero < messageBytes_) && (ISNOTNULLPTR(messageValue_)));
+
+
+  /* Assert if the topic pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __TopicCheck__(topic_));
+
+
+  /* Check if the topic pointer, message bytes and message value are valid. */
+  if ((RETURN_SUCCESS == __TopicCheck__(topic_)) && (zero < messageBytes_) && (ISNOTNULLPTR(messageValue_))) {
+
+
+    /* Allocate the message and its value together. The value begins
+       immediately after the message. */
+    message = (TopicMessage_t *)__HeapAllocateMemory__(sizeof(TopicMessage_t) + messageBytes_);
+
+
+    /* Assert if __HeapAllocateMemory__() failed to allocate the memory. */
+    SYSASSERT(ISNOTNULLPTR(message));
+
+
+    /* Check to make sure __HeapAllocateMemory__() did its job. */
+    if (ISNOTNULLPTR(message)) {
+
+
+      /* The publisher holds a reference while the message is delivered
+         so the message can't be freed part way through. */
+      message->references = 1u;
+
+      message->messageBytes = messageBytes_;
+
+      message->messageValue = (Byte_t *)(message + 1);
+
+      __memcpy__(message->messageValue, messageValue_, messageBytes_);
+
+
+      for (i = zero; i < topic_->limit; i++) {
+
+
+        /* A subscriber that is locked or full misses the message. */
+        if ((ISNOTNULLPTR(topic_->subscribers[i])) && (false == topic_->subscribers[i]->locked)) {
+
+
+          reference = __QueueReserve__(topic_->subscribers[i], sizeof(TopicMessage_t *), zero);
+
+
+          if (ISNOTNULLPTR(reference)) {
+
+
+            __memcpy__(reference + 1, &message, sizeof(TopicMessage_t *));
+
+            message->references++;
+
+            ret++;
+          }
+        }
+      }
+
+
+      /* Drop the publisher's reference. If no subscriber took the message
+         it is freed now. */
+      xTopicRelease(message);
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xTopicReceive() system call will receive the next message published to the topic the
+   queue subscribes to. The caller holds a reference to the message and must release it with
+   xTopicRelease() when it is done with it. */
+TopicMessage_t *xTopicReceive(Queue_t *queue_) {
+
+
+  TopicMessage_t *ret = NULL;
+
+  Message_t *message = NULL;
+
+
+  /* Assert if the queue pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
+
+
+  /* Check if the queue pointer is valid and a message is waiting. */
+  if ((RETURN_SUCCESS == __QueueCheck__(queue_)) && (zero < queue_->length)) {
+
+
+    message = __QueueHead__(queue_);
+
+
+    /* Check the message holds a reference before trusting it. */
+    if (sizeof(TopicMessage_t *) == message->messageBytes) {
+
+
+      __memcpy__(&ret, message + 1, sizeof(TopicMessage_t *));
+
+
+      /* Assert if the reference is not to a heap allocation. */
+      SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckHeap__(ret, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK));
+
+
+      if (RETURN_SUCCESS != __MemoryRegionCheckHeap__(ret, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK)) {
+
+        ret = NULL;
+      }
+
+
+      /* The queue's reference passes to the caller. */
+      __QueueAdvance__(queue_, true);
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xTopicRelease() system call releases a reference to a message received by xTopicReceive().
+   The message is freed when the last reference is released. */
+void xTopicRelease(TopicMessage_t *message_) {
+
+
+  Base_t last = false;
+
+
+  /* Assert if the message pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckHeap__(message_, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK));
+
+
+  /* Check if the message pointer the end-user passed is valid. If so,
+     continue. Otherwise, head toward the exit. */
+  if (RETURN_SUCCESS == __MemoryRegionCheckHeap__(message_, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK)) {
+
+
+    DISABLE_INTERRUPTS();
+
+    message_->references--;
+
+    last = (zero == message_->references) ? true : false;
+
+    ENABLE_INTERRUPTS();
+
+
+    if (true == last) {
+
+      __HeapFreeMemory__(message_);
+    }
+  }
+
+
+  return;
+}
+
+
+
+/* The __TopicCheck__() function validates a topic handle by checking its kernel memory
+   entry. */
+static Base_t __TopicCheck__(const Topic_t *topic_) {
+
+
+  return __MemoryRegionCheckKernel__(topic_, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK);
+}
+
+
+
+/* The __TopicDrain__() function releases every reference waiting in a queue that no longer
+   subscribes to a topic. */
+static void __TopicDrain__(Queue_t *queue_) {
+
+
+  TopicMessage_t *message = NULL;
+
+  Base_t length = zero;
+
+
+  while (zero < queue_->length) {
+
+
+    length = queue_->length;
+
+    message = xTopicReceive(queue_);
+
+
+    if (ISNOTNULLPTR(message)) {
+
+      xTopicRelease(message);
+
+    } else if (length == queue_->length) {
+
+
+      /* Drop anything that is not a reference. */
+      __QueueAdvance__(queue_, true);
+
+    } else {
+      /* Nothing to do here.. Just for MISRA C:2012 compliance. */
+    }
+  }
+
+
+  return;
+}
+
+
+
+/* The xQueueGetStats() system call will return the statistics for a queue. The statistics
+   are only kept if CONFIG_ENABLE_QUEUE_STATS is defined, otherwise null is returned. */
+QueueStats_t *xQueueGetStats(const Queue_t *queue_) {
+
+
+  QueueStats_t *ret = NULL;
+
+
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+
+
+  /* Assert if the queue pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __QueueCheck__(queue_));
+
+
+  /* Check if the queue pointer the end-user passed is valid. If so,
+     continue. Otherwise, head toward the exit. */
+  if (RETURN_SUCCESS == __QueueCheck__(queue_)) {
+
+
+    ret = (QueueStats_t *)__HeapAllocateMemory__(sizeof(QueueStats_t));
+
+
+    /* Assert if __HeapAllocateMemory__() failed to allocate the memory. */
+    SYSASSERT(ISNOTNULLPTR(ret));
+
+
+    /* Check to make sure __HeapAllocateMemory__() did its job. */
+    if (ISNOTNULLPTR(ret)) {
+
+
+      __memcpy__(ret, &queue_->stats, sizeof(QueueStats_t));
+
+
+      /* Only the total latency is kept, the average is worked out here. If
+         no message has been received there is no latency to report. */
+      if (zero < queue_->stats.dequeued) {
+
+        ret->averageLatency = queue_->totalLatency / queue_->stats.dequeued;
+
+      } else {
+
+        ret->minimumLatency = zero;
+      }
+    }
+  }
+
+
+#endif
+
+
+  return ret;
+}
+
+
+
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+
+
+/* The __QueueStatsEnqueue__() function stamps a message with the time it was sent and
+   counts it. It is only used when CONFIG_ENABLE_QUEUE_STATS is defined. */
+static void __QueueStatsEnqueue__(Queue_t *queue_, Message_t *message_) {
+
+
+  message_->timestamp = __SysGetSysTicks__();
+
+  queue_->stats.enqueued++;
+
+
+  if (queue_->stats.highWater < queue_->length) {
+
+    queue_->stats.highWater = queue_->length;
+  }
+
+
+  return;
+}
+
+
+
+/* The __QueueStatsDequeue__() function counts a message leaving the queue. A received
+   message adds the time it waited in the queue to the latency statistics, a message a
+   mailbox dropped to make room is only counted as overwritten. It is only used when
+   CONFIG_ENABLE_QUEUE_STATS is defined. */
+static void __QueueStatsDequeue__(Queue_t *queue_, const Message_t *message_, const Base_t received_) {
+
+
+  Ticks_t latency = zero;
+
+  Ticks_t ticks = zero;
+
+  Base_t bucket = zero;
+
+
+  if (true == received_) {
+
+
+    latency = __SysGetSysTicks__() - message_->timestamp;
+
+    queue_->stats.dequeued++;
+
+    queue_->totalLatency += latency;
+
+
+    if (queue_->stats.minimumLatency > latency) {
+
+      queue_->stats.minimumLatency = latency;
+    }
+
+
+    if (queue_->stats.maximumLatency < latency) {
+
+      queue_->stats.maximumLatency = latency;
+    }
+
+
+    /* Find the power of two bucket for the latency, the last bucket
+       counts everything longer. */
+    ticks = latency;
+
+    while ((1u < ticks) && ((QUEUE_LATENCY_HISTOGRAM_BUCKETS - 1u) > bucket)) {
+
+      ticks >>= 1u;
+
+      bucket++;
+    }
+
+    queue_->stats.latencyHistogram[bucket]++;
+
+  } else {
+
+
+    queue_->stats.overwritten++;
+  }
+
+
+  return;
+}
+
+
+#endif
+
+
+
+/* The __QueueCheck__() function validates a queue handle. By default only the kernel memory
+   entry that holds the queue is checked so the cost is constant regardless of how many kernel
+   objects exist. If CONFIG_ENABLE_QUEUE_AUDIT is defined, the entire kernel memory region is
+   walked and the queue's ring of messages is checked for consistency. */
+static Base_t __QueueCheck__(const Queue_t *queue_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+
+#if defined(CONFIG_ENABLE_QUEUE_AUDIT)
+
+
+  /* Check if the kernel memory region is healthy and the queue pointer is valid. */
+  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
+
+
+    /* Assert if the walk of the queue's ring disagrees with its head, tail
+       and length. */
+    SYSASSERT(RETURN_SUCCESS == __QueueAudit__(queue_));
+
+
+    /* Check if the walk of the queue's ring agrees with its head, tail and
+       length. */
+    if (RETURN_SUCCESS == __QueueAudit__(queue_)) {
+
+
+      ret = RETURN_SUCCESS;
+    }
+  }
+
+
+#else
+
+
+  /* Check if the queue pointer is valid by checking only its kernel
+     memory entry. */
+  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK)) {
+
+
+    ret = RETURN_SUCCESS;
+  }
+
+
+#endif
+
+
+  return ret;
+}
+
+
+
+/* The __QueueRecordBytes__() function returns the number of bytes a message with the
+   specified number of value bytes occupies in the queue's ring. Messages in a fixed
+   size queue always occupy the same number of bytes. */
+static Size_t __QueueRecordBytes__(const Queue_t *queue_, const Base_t messageBytes_) {
+
+
+  Size_t ret = zero;
+
+
+  if (true == queue_->variable) {
+
+
+    ret = QUEUE_RECORD_BYTES(messageBytes_);
+
+  } else {
+
+
+    ret = QUEUE_RECORD_BYTES(queue_->messageBytes);
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __QueueRoom__() function checks if the queue's ring has room for a message
+   that occupies the specified number of bytes. Messages are never split across the end
+   of the ring so if the message does not fit between the tail and the end of the ring,
+   it must fit between the beginning of the ring and the head. If there is room, the
+   offset of where the message would go is returned through the offset parameter. */
+static Base_t __QueueRoom__(const Queue_t *queue_, const Size_t recordBytes_, Size_t *offset_) {
+
+
+  Base_t ret = false;
+
+
+  /* Check if the queue is below its limit, otherwise there is never room. */
+  if (queue_->limit > queue_->length) {
+
+
+    /* A priority queue has room as long as it has a free slot. */
+    if (true == queue_->priority) {
+
+
+      *offset_ = zero;
+
+      ret = true;
+
+
+      /* If the queue is empty, the message goes at the beginning of the ring. */
+    } else if (zero == queue_->length) {
+
+
+      if (queue_->size >= recordBytes_) {
+
+        *offset_ = zero;
+
+        ret = true;
+      }
+
+
+      /* If the tail is ahead of the head, the free space is between the tail and the end of
+         the ring and between the beginning of the ring and the head. */
+    } else if (queue_->tail > queue_->head) {
+
+
+      if ((queue_->size - queue_->tail) >= recordBytes_) {
+
+        *offset_ = queue_->tail;
+
+        ret = true;
+
+      } else if (queue_->head >= recordBytes_) {
+
+        *offset_ = zero;
+
+        ret = true;
+      }
+
+
+      /* Otherwise the tail has wrapped and the free space is between the tail
+         and the head. */
+    } else if ((queue_->head - queue_->tail) >= recordBytes_) {
+
+
+      *offset_ = queue_->tail;
+
+      ret = true;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __QueueReserve__() function reserves room in the queue for a message with the
+   specified number of value bytes and returns its header. The caller copies the message
+   value in right behind the header. If there is no room, null is returned. */
+static Message_t *__QueueReserve__(Queue_t *queue_, const Base_t messageBytes_, const Base_t priority_) {
+
+
+  Message_t *ret = NULL;
+
+  Size_t recordBytes = zero;
+
+  Size_t offset = zero;
+
+  Base_t slot = zero;
+
+  Message_t *dropped = NULL;
+
+  TopicMessage_t *reference = NULL;
+
+
+  /* A full mailbox makes room by dropping its oldest message. Every record
+     in a mailbox is the same size so dropping one is always enough. */
+  if ((true == queue_->overwrite) && (zero < queue_->length) && (queue_->limit == queue_->length)) {
+
+
+    dropped = __QueueHead__(queue_);
+
+
+    /* If the mailbox subscribes to a topic, the dropped message is a reference
+       to a topic message so release it or the topic message is never freed. */
+    if ((ISNOTNULLPTR(queue_->topic)) && (sizeof(TopicMessage_t *) == dropped->messageBytes)) {
+
+      __memcpy__(&reference, dropped + 1, sizeof(TopicMessage_t *));
+    }
+
+
+    __QueueAdvance__(queue_, false);
+
+
+    if (ISNOTNULLPTR(reference)) {
+
+      xTopicRelease(reference);
+    }
+  }
+
+
+  recordBytes = __QueueRecordBytes__(queue_, messageBytes_);
+
+
+  if ((true == queue_->priority) && (true == __QueueRoom__(queue_, recordBytes, &offset))) {
+
+
+    /* Take a slot from the free list and append it to the list of
+       messages with the same priority so messages of equal priority
+       stay in FIFO order. */
+    slot = queue_->freeSlot;
+
+    ret = __QueueSlot__(queue_, slot);
+
+    queue_->freeSlot = *__QueueLink__(queue_, slot);
+
+    ret->messageBytes = messageBytes_;
+
+    *__QueueLink__(queue_, slot) = QUEUE_SLOT_NONE;
+
+
+    if (QUEUE_SLOT_NONE == queue_->priorityTails[priority_]) {
+
+      queue_->priorityHeads[priority_] = slot;
+
+    } else {
+
+      *__QueueLink__(queue_, queue_->priorityTails[priority_]) = slot;
+    }
+
+    queue_->priorityTails[priority_] = slot;
+
+    queue_->priorityMap |= (Base_t)(1u << priority_);
+
+    queue_->length++;
+
+    queue_->sequence++;
+
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+    __QueueStatsEnqueue__(queue_, ret);
+#endif
+
+    __QueueNotify__(queue_, queue_->length - 1u);
+
+  } else if ((false == queue_->priority) && (true == __QueueRoom__(queue_, recordBytes, &offset))) {
+
+
+    /* If the message is going to the beginning of the ring but the queue
+       is not empty, leave a wrap marker (a header with zero message bytes)
+       at the tail so __QueueAdvance__() knows to skip to the beginning
+       of the ring. */
+    if ((zero < queue_->length) && (offset != queue_->tail)) {
+
+      ((Message_t *)&queue_->messages[queue_->tail])->messageBytes = zero;
+
+    } else if (zero == queue_->length) {
+
+      queue_->head = zero;
+    }
+
+
+    ret = (Message_t *)&queue_->messages[offset];
+
+    ret->messageBytes = messageBytes_;
+
+    queue_->tail = offset + recordBytes;
+
+
+    /* If the tail reached the end of the ring, the next message starts at
+       the beginning of it. */
+    if (queue_->size <= queue_->tail) {
+
+      queue_->tail = zero;
+    }
+
+    queue_->length++;
+
+    queue_->sequence++;
+
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+    __QueueStatsEnqueue__(queue_, ret);
+#endif
+
+    __QueueNotify__(queue_, queue_->length - 1u);
+  }
+
+
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+
+  if (ISNULLPTR(ret)) {
+
+    queue_->stats.rejectedFull++;
+  }
+
+#endif
+
+
+  return ret;
+}
+
+
+
+/* The __QueueHead__() function returns the header of the next message to be received
+   from the queue or null if the queue is empty. */
+static Message_t *__QueueHead__(const Queue_t *queue_) {
+
+
+  Message_t *ret = NULL;
+
+
+  if ((true == queue_->priority) && (zero < queue_->length)) {
+
+
+    ret = __QueueSlot__(queue_, queue_->priorityHeads[__QueueHighestPriority__(queue_)]);
+
+  } else if (zero < queue_->length) {
+
+
+    ret = (Message_t *)&queue_->messages[queue_->head];
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __QueueSlot__() function returns the header of a slot in a priority queue. */
+static Message_t *__QueueSlot__(const Queue_t *queue_, const Base_t slot_) {
+
+
+  return (Message_t *)&queue_->messages[slot_ * QUEUE_RECORD_BYTES(queue_->messageBytes)];
+}
+
+
+
+/* The __QueueLink__() function returns the link of a slot in a priority queue. The links
+   are kept in their own array after the slots so messages in the other kinds of queue
+   don't pay for them. */
+static Base_t *__QueueLink__(const Queue_t *queue_, const Base_t slot_) {
+
+
+  return (Base_t *)&queue_->messages[queue_->size + slot_];
+}
+
+
+
+/* The __QueueHighestPriority__() function returns the highest priority that has a message
+   waiting in a priority queue. The scan is bounded by QUEUE_PRIORITY_LEVELS so it takes
+   constant time regardless of how many messages are waiting. */
+static Base_t __QueueHighestPriority__(const Queue_t *queue_) {
+
+
+  Base_t ret = QUEUE_PRIORITY_LEVELS - 1u;
+
+
+  while ((zero < ret) && (zero == (queue_->priorityMap & (1u << ret)))) {
+
+    ret--;
+  }
+
+
+  return ret;
+}
+
+
+
+#if defined(CONFIG_ENABLE_QUEUE_AUDIT)
+
+
+/* The __QueueAudit__() function walks the messages in the queue's ring from the head
+   and checks that the walk agrees with the queue's length and ends at its tail. It is
+   only used when CONFIG_ENABLE_QUEUE_AUDIT is defined. */
+static Base_t __QueueAudit__(const Queue_t *queue_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Base_t messages = zero;
+
+  Size_t cursor = zero;
+
+  Message_t *message = NULL;
+
+  Base_t priority = zero;
+
+  Base_t slot = zero;
+
+  Base_t slots = zero;
+
+  Base_t corrupt = false;
+
+
+  /* Check that the slots immediately follow the priority queue. */
+  if ((true == queue_->priority) && ((Byte_t *)(queue_ + 1) == queue_->messages) && (queue_->limit >= queue_->length)) {
+
+
+    /* Walk the list of each priority, checking that its bit in the priority
+       map agrees with whether the list is empty and that its tail is its last
+       slot. Every walk is bounded by the limit in case a list is corrupt. */
+    for (priority = zero; priority < QUEUE_PRIORITY_LEVELS; priority++) {
+
+
+      slot = queue_->priorityHeads[priority];
+
+      if ((QUEUE_SLOT_NONE == slot) == (zero != (queue_->priorityMap & (1u << priority)))) {
+
+        corrupt = true;
+      }
+
+
+      while ((QUEUE_SLOT_NONE != slot) && (queue_->limit > slot) && (queue_->limit >= messages)) {
+
+
+        if ((QUEUE_SLOT_NONE == *__QueueLink__(queue_, slot)) && (queue_->priorityTails[priority] != slot)) {
+
+          corrupt = true;
+        }
+
+        messages++;
+
+        slot = *__QueueLink__(queue_, slot);
+      }
+    }
+
+
+    slot = queue_->freeSlot;
+
+
+    /* Walk the free list. */
+    while ((QUEUE_SLOT_NONE != slot) && (queue_->limit > slot) && (queue_->limit >= slots)) {
+
+
+      slots++;
+
+      slot = *__QueueLink__(queue_, slot);
+    }
+
+
+    /* Every slot must be either on a priority list or the free list. */
+    if ((false == corrupt) && (messages == queue_->length) && ((messages + slots) == queue_->limit)) {
+
+
+      ret = RETURN_SUCCESS;
+    }
+
+
+    /* Check that the ring immediately follows the queue and that the head and tail
+       are inside the ring. */
+  } else if ((false == queue_->priority) && ((Byte_t *)(queue_ + 1) == queue_->messages) && (queue_->limit >= queue_->length) && (queue_->size > queue_->head) && (queue_->size > queue_->tail)) {
+
+
+    cursor = queue_->head;
+
+
+    /* Walk the messages in the ring, skipping to the beginning of the ring
+       when the end of the ring or a wrap marker is reached. */
+    while ((messages < queue_->length) && (queue_->size > cursor)) {
+
+
+      message = (Message_t *)&queue_->messages[cursor];
+
+
+      if ((zero == message->messageBytes) && (zero != cursor)) {
+
+
+        cursor = zero;
+
+      } else if ((zero < message->messageBytes) && (queue_->messageBytes >= message->messageBytes)) {
+
+
+        cursor += __QueueRecordBytes__(queue_, message->messageBytes);
+
+        messages++;
+
+
+        if (queue_->size <= cursor) {
+
+          cursor = zero;
+        }
+
+      } else {
+
+
+        /* The message header is corrupt so stop walking. */
+        break;
+      }
+    }
+
+
+    /* The walk must have found every message and ended at the tail. */
+    if ((messages == queue_->length) && (cursor == queue_->tail)) {
+
+
+      ret = RETURN_SUCCESS;
+    }
+  }
+
+
+  return ret;
+}
+
+
+#endif
@@ -42,17 +42,46 @@ extern "C" {
 #endif
 
 Queue_t *xQueueCreate(const Base_t limit_);
+Queue_t *xQueueCreateEx(const Base_t limit_, const Base_t messageBytes_);
+Queue_t *xQueueCreateVariable(const Base_t limit_, const Size_t bytes_);
+Queue_t *xQueueCreatePriority(const Base_t limit_, const Base_t messageBytes_);
+Queue_t *xQueueCreateMailbox(const Base_t limit_, const Base_t messageBytes_);
 void xQueueDelete(Queue_t *queue_);
 Base_t xQueueGetLength(const Queue_t *queue_);
 Base_t xQueueIsQueueEmpty(const Queue_t *queue_);
 Base_t xQueueIsQueueFull(const Queue_t *queue_);
 Base_t xQueueMessagesWaiting(const Queue_t *queue_);
 Base_t xQueueSend(Queue_t *queue_, const Base_t messageBytes_, const Char_t *messageValue_);
+Base_t xQueueSendPriority(Queue_t *queue_, const Base_t priority_, const Base_t messageBytes_, const Char_t *messageValue_);
+Base_t xQueueSendBatch(Queue_t *queue_, const Base_t count_, const QueueMessage_t *messages_, const Base_t mode_);
+Base_t xQueueReceiveBatch(Queue_t *queue_, const Base_t max_, QueueMessage_t *messages_);
 QueueMessage_t *xQueuePeek(const Queue_t *queue_);
 void xQueueDropMessage(Queue_t *queue_);
 QueueMessage_t *xQueueReceive(Queue_t *queue_);
+Base_t xQueueReceiveBytes(Queue_t *queue_, const Base_t bufferBytes_, Char_t *buffer_);
+Base_t xQueueReceiveInto(Queue_t *queue_, QueueMessage_t *message_);
+Base_t xQueueReceiveSequence(Queue_t *queue_, QueueMessage_t *message_, Word_t *sequence_);
+const Char_t *xQueuePeekRef(const Queue_t *queue_, Base_t *messageBytes_);
 void xQueueLockQueue(Queue_t *queue_);
 void xQueueUnLockQueue(Queue_t *queue_);
+QueueSet_t *xQueueSetCreate(Task_t *task_, const Base_t limit_);
+void xQueueSetDelete(QueueSet_t *set_);
+Base_t xQueueSetAdd(QueueSet_t *set_, Queue_t *queue_);
+Base_t xQueueSetRemove(QueueSet_t *set_, Queue_t *queue_);
+Queue_t *xQueueSetSelect(QueueSet_t *set_);
+QueueStats_t *xQueueGetStats(const Queue_t *queue_);
+Topic_t *xTopicCreate(const Base_t limit_);
+void xTopicDelete(Topic_t *topic_);
+Base_t xTopicSubscribe(Topic_t *topic_, Queue_t *queue_);
+Base_t xTopicUnsubscribe(Topic_t *topic_, Queue_t *queue_);
+Base_t xTopicPublish(Topic_t *topic_, const Size_t messageBytes_, const Byte_t *messageValue_);
+TopicMessage_t *xTopicReceive(Queue_t *queue_);
+void xTopicRelease(TopicMessage_t *message_);
+SPSCQueue_t *xSPSCQueueCreate(const Base_t limit_, const Base_t messageBytes_);
+void xSPSCQueueDelete(SPSCQueue_t *queue_);
+Base_t xSPSCQueueSend(SPSCQueue_t *queue_, const Base_t messageBytes_, const Char_t *messageValue_);
+Base_t xSPSCQueueReceive(SPSCQueue_t *queue_, QueueMessage_t *message_);
+Base_t xSPSCQueueGetLength(const SPSCQueue_t *queue_);
 
 #ifdef __cplusplus
 }
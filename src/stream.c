@@ -25,25 +25,64 @@
  */
 #include "stream.h"
 
+static Pipe_t *pipeList = NULL;
+
+static StreamBuffer_t *triggerList = NULL;
+
+static void __StreamClear__(const StreamBuffer_t *stream_);
+static void __StreamRead__(const StreamBuffer_t *stream_, Byte_t *bytes_, const HalfWord_t length_, const Base_t consume_);
+static Base_t __StreamReadInto__(const StreamBuffer_t *stream_, Byte_t *bytes_, const HalfWord_t max_, HalfWord_t *received_, const Base_t consume_);
+static void __StreamWrite__(StreamBuffer_t *stream_, const Byte_t *bytes_, const HalfWord_t length_);
+static void __StreamCommit__(StreamBuffer_t *stream_, const HalfWord_t length_);
+static void __StreamConsume__(StreamBuffer_t *stream_, const HalfWord_t length_);
+static Base_t __PipeListFind__(const Pipe_t *pipe_);
+static void __StreamTriggerUnlink__(const StreamBuffer_t *stream_);
+static Base_t __BroadcastReaderCheck__(const BroadcastStream_t *stream_, const Base_t reader_);
+static Base_t __MessageBufferCheck__(const MessageBuffer_t *buffer_);
+static Byte_t *__MessageBufferReserve__(MessageBuffer_t *buffer_, const HalfWord_t bytes_);
+static void __MessageBufferCommit__(MessageBuffer_t *buffer_, const HalfWord_t bytes_);
+static Byte_t *__MessageBufferAcquire__(MessageBuffer_t *buffer_, HalfWord_t *bytes_);
+static void __MessageBufferRelease__(MessageBuffer_t *buffer_);
+
 
 
 /* The xStreamCreate() system call will create a new stream. Streams
-   are fast for sending streams of bytes between tasks. */
+   are fast for sending streams of bytes between tasks. The stream
+   holds CONFIG_STREAM_BUFFER_BYTES bytes. */
 StreamBuffer_t *xStreamCreate() {
 
 
+  return xStreamCreateEx(CONFIG_STREAM_BUFFER_BYTES);
+}
+
+
+
+/* The xStreamCreateEx() system call will create a new stream that holds
+   the specified number of bytes. The buffer is allocated together with
+   the stream so memory use matches what each stream actually needs. */
+StreamBuffer_t *xStreamCreateEx(const HalfWord_t capacity_) {
+
+
 
   StreamBuffer_t *ret = NULL;
 
 
 
+  /* Assert if the end-user passed a capacity of zero. */
+  SYSASSERT(zero < capacity_);
 
-  ret = (StreamBuffer_t *)__KernelAllocateMemory__(sizeof(StreamBuffer_t));
 
+  /* Check if the capacity is greater than zero, if not head toward the exit. */
+  if (zero < capacity_) {
 
-  /* Assert if xMemAlloc() didn't return our requested
-     kernel memory. */
-  SYSASSERT(ISNOTNULLPTR(ret));
+
+    ret = (StreamBuffer_t *)__KernelAllocateMemory__(sizeof(StreamBuffer_t) + (capacity_ * sizeof(Byte_t)));
+
+
+    /* Assert if xMemAlloc() didn't return our requested
+       kernel memory. */
+    SYSASSERT(ISNOTNULLPTR(ret));
+  }
 
 
   /* Check if xMemAlloc() returned our requested
@@ -51,7 +90,26 @@ StreamBuffer_t *xStreamCreate() {
   if (ISNOTNULLPTR(ret)) {
 
 
+    /* The buffer begins immediately after the stream. */
+    ret->buffer = (Byte_t *)(ret + 1);
+
+    ret->capacity = capacity_;
+
+    ret->highWater = zero;
+
+    ret->triggerLevel = zero;
+
+    ret->triggerTask = NULL;
+
+    ret->triggerNext = NULL;
+
+    ret->head = zero;
+
+    ret->tail = zero;
+
     ret->length = zero;
+
+    ret->waiter = NULL;
   }
 
 
@@ -65,6 +123,12 @@ StreamBuffer_t *xStreamCreate() {
 void xStreamDelete(const StreamBuffer_t *stream_) {
 
 
+  Pipe_t *cursor = NULL;
+
+  Pipe_t *next = NULL;
+
+
+
   /* Assert if the heap fails its health check or if the stream pointer the end-user
      passed is invalid. */
   SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
@@ -76,6 +140,34 @@ void xStreamDelete(const StreamBuffer_t *stream_) {
   if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
 
 
+    /* Release a task waiting on the stream so it doesn't point at a freed stream. */
+    if (ISNOTNULLPTR(stream_->waiter)) {
+
+      __TaskWaitDetach__(stream_->waiter);
+    }
+
+
+    /* Take the stream off the list of streams with a trigger task. */
+    __StreamTriggerUnlink__(stream_);
+
+
+    /* Delete any pipe connected to the stream. */
+    cursor = pipeList;
+
+    while (ISNOTNULLPTR(cursor)) {
+
+
+      next = cursor->next;
+
+
+      if (stream_ == cursor->stream) {
+
+        xPipeDelete(cursor);
+      }
+
+      cursor = next;
+    }
+
 
     __KernelFreeMemory__(stream_);
   }
@@ -89,7 +181,9 @@ void xStreamDelete(const StreamBuffer_t *stream_) {
 /* The xStreamSend() system call will send one byte to
    the designated stream. Sending to a stream must be done
    one byte at a time. However, receiving from a stream
-   will return all available bytes in a stream. */
+   will return all available bytes in a stream. The stream
+   buffer is a ring so the byte is written at the tail, which
+   wraps to the start of the buffer once it reaches the end. */
 Base_t xStreamSend(StreamBuffer_t *stream_, const Byte_t byte_) {
 
   Base_t ret = RETURN_FAILURE;
@@ -106,15 +200,11 @@ Base_t xStreamSend(StreamBuffer_t *stream_, const Byte_t byte_) {
 
 
     /* Check to make sure our stream buffer is less than
-       CONFIG_STREAM_BUFFER_BYTES in length before we attempt
-       to write a byte to it. */
-    if (CONFIG_STREAM_BUFFER_BYTES > stream_->length) {
+       its capacity in length before we attempt to write a
+       byte to it. */
+    if (stream_->capacity > stream_->length) {
 
-      stream_->length++;
-
-      /* Offset the stream buffer length by -1 because array
-         is base zero. */
-      stream_->buffer[stream_->length - 1] = byte_;
+      __StreamWrite__(stream_, &byte_, 1u);
 
       ret = RETURN_SUCCESS;
     }
@@ -126,6 +216,66 @@ Base_t xStreamSend(StreamBuffer_t *stream_, const Byte_t byte_) {
 
 
 
+/* The xStreamSendBytes() system call will send several bytes to the designated stream.
+   The stream is validated once and the bytes are copied into the ring in at most two
+   pieces, which is much cheaper than calling xStreamSend() once per byte. In all or
+   nothing mode either every byte is written or none are. In partial mode as many bytes
+   as fit are written. The number of bytes written is returned. */
+HalfWord_t xStreamSendBytes(StreamBuffer_t *stream_, const Byte_t *bytes_, const HalfWord_t length_, const Base_t mode_) {
+
+
+  HalfWord_t ret = zero;
+
+  HalfWord_t space = zero;
+
+
+  /* Assert if the end-user passed a null byte array, zero bytes or an unknown mode. */
+  SYSASSERT((ISNOTNULLPTR(bytes_)) && (zero < length_) && ((STREAM_SEND_ALL_OR_NOTHING == mode_) || (STREAM_SEND_PARTIAL == mode_)));
+
+
+  /* Assert if the stream pointer the end-user passed is invalid. Only the stream's kernel
+     memory entry is checked, like the queue system calls, so a bulk send does not pay for
+     walking the kernel memory region. */
+  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK));
+
+
+
+  /* Check if the parameters are valid and the stream pointer the end-user passed is
+     valid. If so, continue. Otherwise, head toward the exit. */
+  if ((ISNOTNULLPTR(bytes_)) && (zero < length_) && ((STREAM_SEND_ALL_OR_NOTHING == mode_) || (STREAM_SEND_PARTIAL == mode_)) &&
+      (RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK))) {
+
+
+    space = stream_->capacity - stream_->length;
+
+
+    if (length_ <= space) {
+
+
+      ret = length_;
+
+    } else if (STREAM_SEND_PARTIAL == mode_) {
+
+
+      ret = space;
+
+    } else {
+      /* Nothing to do here.. Just for MISRA C:2012 compliance. */
+    }
+
+
+    if (zero < ret) {
+
+      __StreamWrite__(stream_, bytes_, ret);
+    }
+  }
+
+
+  return ret;
+}
+
+
+
 /* The xStreamReceive() system call will receive all waiting bytes
    in the stream. */
 Byte_t *xStreamReceive(const StreamBuffer_t *stream_, HalfWord_t *bytes_) {
@@ -174,9 +324,7 @@ Byte_t *xStreamReceive(const StreamBuffer_t *stream_, HalfWord_t *bytes_) {
 
           *bytes_ = stream_->length;
 
-          __memcpy__(ret, stream_->buffer, stream_->length * sizeof(Byte_t));
-
-          __memset__(stream_, zero, sizeof(StreamBuffer_t));
+          __StreamRead__(stream_, ret, stream_->length, true);
         }
       }
     }
@@ -187,6 +335,27 @@ Byte_t *xStreamReceive(const StreamBuffer_t *stream_, HalfWord_t *bytes_) {
 
 
 
+/* The xStreamReceiveInto() system call will receive up to the specified number of bytes
+   from the stream into the end-user's buffer. Any bytes that don't fit stay in the
+   stream for the next receive. No heap memory is allocated. */
+Base_t xStreamReceiveInto(const StreamBuffer_t *stream_, Byte_t *bytes_, const HalfWord_t max_, HalfWord_t *received_) {
+
+
+  return __StreamReadInto__(stream_, bytes_, max_, received_, true);
+}
+
+
+
+/* The xStreamPeekInto() system call will copy up to the specified number of bytes from
+   the stream into the end-user's buffer without consuming them. */
+Base_t xStreamPeekInto(const StreamBuffer_t *stream_, Byte_t *bytes_, const HalfWord_t max_, HalfWord_t *received_) {
+
+
+  return __StreamReadInto__(stream_, bytes_, max_, received_, false);
+}
+
+
+
 /* The xStreamBytesAvailable() system call will return the number
    of waiting bytes in the stream. */
 HalfWord_t xStreamBytesAvailable(const StreamBuffer_t *stream_) {
@@ -240,7 +409,7 @@ void xStreamReset(const StreamBuffer_t *stream_) {
     if (zero < stream_->length) {
 
 
-      __memset__(stream_, zero, sizeof(StreamBuffer_t));
+      __StreamClear__(stream_);
     }
   }
 
@@ -282,7 +451,7 @@ Base_t xStreamIsEmpty(const StreamBuffer_t *stream_) {
 
 
 /* The xStreamIsFull() system call will return true if the stream
-   buffer is full (i.e., size is equal to CONFIG_STREAM_BUFFER_BYTES) */
+   buffer is full (i.e., size is equal to its capacity) */
 Base_t xStreamIsFull(const StreamBuffer_t *stream_) {
 
   Base_t ret = false;
@@ -299,7 +468,7 @@ Base_t xStreamIsFull(const StreamBuffer_t *stream_) {
 
 
     /* If there is nothing to receive then just head toward the exit. */
-    if (CONFIG_STREAM_BUFFER_BYTES == stream_->length) {
+    if (stream_->capacity == stream_->length) {
 
 
       ret = true;
@@ -309,3 +478,1642 @@ Base_t xStreamIsFull(const StreamBuffer_t *stream_) {
 
   return ret;
 }
+
+
+
+/* The xStreamGetHighWater() system call will return the highest number of bytes
+   the stream has held since it was created. Comparing it with the capacity shows
+   whether the stream was sized well. */
+HalfWord_t xStreamGetHighWater(const StreamBuffer_t *stream_) {
+
+
+  HalfWord_t ret = zero;
+
+  /* Assert if the heap fails its health check or if the stream pointer the end-user
+     passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+
+
+
+  /* Check if the heap is health and the stream pointer the end-user passed is valid.
+     If so, continue. Otherwise, head toward the exit. */
+  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
+
+
+    ret = stream_->highWater;
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xMessageBufferCreate() system call will create a message buffer. A message buffer
+   stores variable length frames in the ring of a stream, each frame prefixed with its
+   length, so whole frames are written and read instead of bytes. */
+MessageBuffer_t *xMessageBufferCreate(const HalfWord_t capacity_) {
+
+
+  MessageBuffer_t *ret = NULL;
+
+
+  /* Assert if the capacity can't hold a frame of at least one byte. */
+  SYSASSERT(MESSAGE_BUFFER_HEADER_BYTES < capacity_);
+
+
+  /* Check if the capacity can hold a frame of at least one byte, if not
+     head toward the exit. */
+  if (MESSAGE_BUFFER_HEADER_BYTES < capacity_) {
+
+
+    ret = (MessageBuffer_t *)__KernelAllocateMemory__(sizeof(MessageBuffer_t));
+
+
+    /* Assert if xMemAlloc() didn't return our requested
+       kernel memory. */
+    SYSASSERT(ISNOTNULLPTR(ret));
+
+
+    /* Check if xMemAlloc() returned our requested
+       kernel memory. */
+    if (ISNOTNULLPTR(ret)) {
+
+
+      ret->stream = xStreamCreateEx(capacity_);
+
+
+      /* If the stream can't be created then give back the message
+         buffer and head toward the exit. */
+      if (ISNOTNULLPTR(ret->stream)) {
+
+
+        ret->frames = zero;
+
+        ret->frameBytes = zero;
+
+        ret->reserved = false;
+
+        ret->acquired = false;
+
+      } else {
+
+
+        __KernelFreeMemory__(ret);
+
+        ret = NULL;
+      }
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xMessageBufferDelete() system call will delete a message buffer and
+   its stream. */
+void xMessageBufferDelete(MessageBuffer_t *buffer_) {
+
+
+  /* Assert if the message buffer pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MessageBufferCheck__(buffer_));
+
+
+  /* Check if the message buffer pointer the end-user passed is valid. If so,
+     continue. Otherwise, head toward the exit. */
+  if (RETURN_SUCCESS == __MessageBufferCheck__(buffer_)) {
+
+
+    xStreamDelete(buffer_->stream);
+
+    __KernelFreeMemory__(buffer_);
+  }
+
+
+  return;
+}
+
+
+
+/* The xMessageBufferSend() system call will copy a frame into the message buffer. Either the
+   whole frame is written or, if there isn't room, nothing is. */
+Base_t xMessageBufferSend(MessageBuffer_t *buffer_, const HalfWord_t bytes_, const Byte_t *value_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Byte_t *frame = NULL;
+
+
+  /* Assert if the end-user passed zero bytes or a null value. */
+  SYSASSERT((zero < bytes_) && (ISNOTNULLPTR(value_)));
+
+
+  /* Assert if the message buffer pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MessageBufferCheck__(buffer_));
+
+
+  /* Check if the parameters and the message buffer pointer are valid. */
+  if ((zero < bytes_) && (ISNOTNULLPTR(value_)) && (RETURN_SUCCESS == __MessageBufferCheck__(buffer_))) {
+
+
+    frame = __MessageBufferReserve__(buffer_, bytes_);
+
+
+    if (ISNOTNULLPTR(frame)) {
+
+
+      __memcpy__(frame, value_, bytes_ * sizeof(Byte_t));
+
+      __MessageBufferCommit__(buffer_, bytes_);
+
+      ret = RETURN_SUCCESS;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xMessageBufferReceive() system call will copy the next frame in the message buffer into
+   the end-user's buffer and consume it. If the frame is larger than the end-user's buffer it
+   is left in the message buffer. */
+Base_t xMessageBufferReceive(MessageBuffer_t *buffer_, Byte_t *value_, const HalfWord_t max_, HalfWord_t *received_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Byte_t *frame = NULL;
+
+  HalfWord_t bytes = zero;
+
+
+  /* Assert if the end-user passed a null buffer or a null received parameter. */
+  SYSASSERT((ISNOTNULLPTR(value_)) && (ISNOTNULLPTR(received_)));
+
+
+  /* Assert if the message buffer pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MessageBufferCheck__(buffer_));
+
+
+  /* Check if the parameters and the message buffer pointer are valid. */
+  if ((ISNOTNULLPTR(value_)) && (ISNOTNULLPTR(received_)) && (RETURN_SUCCESS == __MessageBufferCheck__(buffer_))) {
+
+
+    frame = __MessageBufferAcquire__(buffer_, &bytes);
+
+
+    if (ISNOTNULLPTR(frame)) {
+
+
+      if (max_ >= bytes) {
+
+
+        __memcpy__(value_, frame, bytes * sizeof(Byte_t));
+
+        __MessageBufferRelease__(buffer_);
+
+        *received_ = bytes;
+
+        ret = RETURN_SUCCESS;
+
+      } else {
+
+
+        /* The frame doesn't fit so leave it where it is. Acquiring a
+           frame changes nothing else so it is enough to drop the
+           acquisition. */
+        buffer_->acquired = false;
+      }
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xMessageBufferReserve() system call will reserve room for a frame in the message buffer
+   and return a pointer to it so the end-user can build the frame in place. The frame is not
+   visible to the reader until xMessageBufferCommit() is called. Only one frame can be reserved
+   at a time. */
+Byte_t *xMessageBufferReserve(MessageBuffer_t *buffer_, const HalfWord_t bytes_) {
+
+
+  Byte_t *ret = NULL;
+
+
+  /* Assert if the end-user passed zero bytes. */
+  SYSASSERT(zero < bytes_);
+
+
+  /* Assert if the message buffer pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MessageBufferCheck__(buffer_));
+
+
+  /* Check if the parameters and the message buffer pointer are valid. */
+  if ((zero < bytes_) && (RETURN_SUCCESS == __MessageBufferCheck__(buffer_))) {
+
+
+    ret = __MessageBufferReserve__(buffer_, bytes_);
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xMessageBufferCommit() system call will commit the frame reserved by
+   xMessageBufferReserve() so the reader can see it. The frame may be committed with fewer
+   bytes than were reserved. Committing zero bytes cancels the reservation. */
+Base_t xMessageBufferCommit(MessageBuffer_t *buffer_, const HalfWord_t bytes_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+
+  /* Assert if the message buffer pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MessageBufferCheck__(buffer_));
+
+
+  /* Check if the message buffer pointer is valid, a frame is reserved and
+     it is not being committed with more bytes than were reserved. */
+  if ((RETURN_SUCCESS == __MessageBufferCheck__(buffer_)) && (true == buffer_->reserved) && (buffer_->reserveBytes >= bytes_)) {
+
+
+    if (zero < bytes_) {
+
+
+      __MessageBufferCommit__(buffer_, bytes_);
+
+    } else {
+
+
+      buffer_->reserved = false;
+    }
+
+
+    ret = RETURN_SUCCESS;
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xMessageBufferAcquire() system call will return a pointer to the next frame in the
+   message buffer without copying it. The frame stays in the message buffer until
+   xMessageBufferRelease() is called. Only one frame can be acquired at a time. */
+Byte_t *xMessageBufferAcquire(MessageBuffer_t *buffer_, HalfWord_t *bytes_) {
+
+
+  Byte_t *ret = NULL;
+
+
+  /* Assert if the end-user passed a null bytes parameter. */
+  SYSASSERT(ISNOTNULLPTR(bytes_));
+
+
+  /* Assert if the message buffer pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MessageBufferCheck__(buffer_));
+
+
+  /* Check if the parameters and the message buffer pointer are valid. */
+  if ((ISNOTNULLPTR(bytes_)) && (RETURN_SUCCESS == __MessageBufferCheck__(buffer_))) {
+
+
+    ret = __MessageBufferAcquire__(buffer_, bytes_);
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xMessageBufferRelease() system call will consume the frame acquired by
+   xMessageBufferAcquire(). */
+Base_t xMessageBufferRelease(MessageBuffer_t *buffer_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+
+  /* Assert if the message buffer pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MessageBufferCheck__(buffer_));
+
+
+  /* Check if the message buffer pointer is valid and a frame is acquired. */
+  if ((RETURN_SUCCESS == __MessageBufferCheck__(buffer_)) && (true == buffer_->acquired)) {
+
+
+    __MessageBufferRelease__(buffer_);
+
+    ret = RETURN_SUCCESS;
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xMessageBufferGetFrames() system call will return the number of frames waiting in
+   the message buffer. */
+HalfWord_t xMessageBufferGetFrames(const MessageBuffer_t *buffer_) {
+
+
+  HalfWord_t ret = zero;
+
+
+  /* Assert if the message buffer pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MessageBufferCheck__(buffer_));
+
+
+  if (RETURN_SUCCESS == __MessageBufferCheck__(buffer_)) {
+
+
+    ret = buffer_->frames;
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xMessageBufferGetBytes() system call will return the number of bytes in the frames
+   waiting in the message buffer, not counting their length prefixes. */
+HalfWord_t xMessageBufferGetBytes(const MessageBuffer_t *buffer_) {
+
+
+  HalfWord_t ret = zero;
+
+
+  /* Assert if the message buffer pointer the end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MessageBufferCheck__(buffer_));
+
+
+  if (RETURN_SUCCESS == __MessageBufferCheck__(buffer_)) {
+
+
+    ret = buffer_->frameBytes;
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xStreamSetTriggerLevel() system call will set the trigger level of a stream. When a
+   send fills the stream from below the trigger level to the trigger level or above, the task
+   is sent a direct to task notification. The task is notified again only after the stream
+   has been drained below the trigger level. Setting the trigger level to zero disables it. */
+Base_t xStreamSetTriggerLevel(StreamBuffer_t *stream_, const HalfWord_t level_, Task_t *task_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  /* Assert if the heap fails its health check or if the stream pointer the end-user
+     passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+
+
+  /* Assert if a non-zero trigger level has no task to notify. */
+  SYSASSERT((zero == level_) || (ISNOTNULLPTR(task_)));
+
+
+
+  /* Check if the stream pointer is valid and a non-zero trigger level has a task
+     to notify. If so, continue. Otherwise, head toward the exit. */
+  if ((RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) && ((zero == level_) || (ISNOTNULLPTR(task_)))) {
+
+
+    if (level_ <= stream_->capacity) {
+
+
+      stream_->triggerLevel = level_;
+
+      stream_->triggerTask = (zero < level_) ? task_ : NULL;
+
+
+      /* Keep the streams with a trigger task on a list so xTaskDelete() can
+         clear the trigger task when the task is deleted. */
+      __StreamTriggerUnlink__(stream_);
+
+
+      if (ISNOTNULLPTR(stream_->triggerTask)) {
+
+
+        stream_->triggerNext = triggerList;
+
+        triggerList = stream_;
+      }
+
+      ret = RETURN_SUCCESS;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __StreamTriggerDetach__() function is called by xTaskDelete() to clear the trigger
+   task of every stream that would notify the task being deleted. */
+void __StreamTriggerDetach__(const Task_t *task_) {
+
+
+  StreamBuffer_t *cursor = NULL;
+
+  StreamBuffer_t *next = NULL;
+
+
+  cursor = triggerList;
+
+
+  while (ISNOTNULLPTR(cursor)) {
+
+
+    next = cursor->triggerNext;
+
+
+    if (task_ == cursor->triggerTask) {
+
+
+      cursor->triggerLevel = zero;
+
+      cursor->triggerTask = NULL;
+
+      __StreamTriggerUnlink__(cursor);
+    }
+
+    cursor = next;
+  }
+
+
+  return;
+}
+
+
+
+/* The __StreamTriggerUnlink__() function takes a stream off the list of streams with a
+   trigger task if it is on it. */
+static void __StreamTriggerUnlink__(const StreamBuffer_t *stream_) {
+
+
+  StreamBuffer_t *cursor = NULL;
+
+  StreamBuffer_t *previous = NULL;
+
+
+  cursor = triggerList;
+
+
+  while ((ISNOTNULLPTR(cursor)) && (cursor != stream_)) {
+
+
+    previous = cursor;
+
+    cursor = cursor->triggerNext;
+  }
+
+
+  if (ISNOTNULLPTR(cursor)) {
+
+
+    if (ISNOTNULLPTR(previous)) {
+
+      previous->triggerNext = cursor->triggerNext;
+
+    } else {
+
+      triggerList = cursor->triggerNext;
+    }
+
+    cursor->triggerNext = NULL;
+  }
+
+
+  return;
+}
+
+
+
+/* The xPipeCreate() system call will create a pipe between a device and a stream. In the
+   PIPE_DEVICE_TO_STREAM direction the kernel reads from the device into the stream whenever
+   the device is available and the stream has room. In the PIPE_STREAM_TO_DEVICE direction the
+   kernel writes from the stream to the device whenever the stream has bytes. The device driver
+   reads and writes the stream's ring directly so there is no intermediate copy. */
+Pipe_t *xPipeCreate(const HalfWord_t uid_, StreamBuffer_t *stream_, const Base_t direction_) {
+
+
+  Pipe_t *ret = NULL;
+
+  Device_t *device = NULL;
+
+
+  /* Assert if the heap fails its health check or if the stream pointer the end-user
+     passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+
+
+  /* Assert if the end-user passed an unknown direction. */
+  SYSASSERT((PIPE_DEVICE_TO_STREAM == direction_) || (PIPE_STREAM_TO_DEVICE == direction_));
+
+
+  if ((RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) && ((PIPE_DEVICE_TO_STREAM == direction_) || (PIPE_STREAM_TO_DEVICE == direction_))) {
+
+
+    device = __DeviceListFind__(uid_);
+
+
+    /* Assert if the device can't be found or its mode doesn't allow
+       the direction of the pipe. */
+    SYSASSERT(ISNOTNULLPTR(device));
+
+
+    /* Check if the device was found and its mode allows the direction
+       of the pipe. */
+    if ((ISNOTNULLPTR(device)) && (((PIPE_DEVICE_TO_STREAM == direction_) && (DeviceModeWriteOnly != device->mode)) ||
+                                   ((PIPE_STREAM_TO_DEVICE == direction_) && (DeviceModeReadOnly != device->mode)))) {
+
+
+      ret = (Pipe_t *)__KernelAllocateMemory__(sizeof(Pipe_t));
+
+
+      /* Assert if xMemAlloc() didn't return our requested
+         kernel memory. */
+      SYSASSERT(ISNOTNULLPTR(ret));
+
+
+      /* Check if xMemAlloc() returned our requested
+         kernel memory. */
+      if (ISNOTNULLPTR(ret)) {
+
+
+        ret->device = device;
+
+        ret->stream = stream_;
+
+        ret->direction = direction_;
+
+        ret->bytesMoved = zero;
+
+        ret->next = pipeList;
+
+        pipeList = ret;
+      }
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xPipeDelete() system call will delete a pipe. The device and stream are left as
+   they are. */
+void xPipeDelete(Pipe_t *pipe_) {
+
+
+  Pipe_t *cursor = NULL;
+
+  Pipe_t *previous = NULL;
+
+
+  /* Assert if the pipe can't be found. */
+  SYSASSERT(RETURN_SUCCESS == __PipeListFind__(pipe_));
+
+
+  /* Check if the pipe can be found. If so, continue. Otherwise, head toward the exit. */
+  if (RETURN_SUCCESS == __PipeListFind__(pipe_)) {
+
+
+    cursor = pipeList;
+
+
+    while ((ISNOTNULLPTR(cursor)) && (cursor != pipe_)) {
+
+
+      previous = cursor;
+
+      cursor = cursor->next;
+    }
+
+
+    if (ISNULLPTR(previous)) {
+
+
+      pipeList = pipe_->next;
+
+    } else {
+
+
+      previous->next = pipe_->next;
+    }
+
+
+    __KernelFreeMemory__(pipe_);
+  }
+
+
+  return;
+}
+
+
+
+/* The xPipeGetBytesMoved() system call will return the number of bytes the pipe has
+   moved between its device and stream. */
+Word_t xPipeGetBytesMoved(const Pipe_t *pipe_) {
+
+
+  Word_t ret = zero;
+
+
+  /* Assert if the pipe can't be found. */
+  SYSASSERT(RETURN_SUCCESS == __PipeListFind__(pipe_));
+
+
+  if (RETURN_SUCCESS == __PipeListFind__(pipe_)) {
+
+
+    ret = pipe_->bytesMoved;
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __PipeService__() function is called by the scheduler on every pass to move bytes
+   through the pipes. Each pipe moves at most one contiguous piece of the stream's ring per
+   pass, which the device driver reads into or writes from directly. A device driver must not
+   read more bytes than it is offered in its size parameter. */
+void __PipeService__(void) {
+
+
+  Pipe_t *cursor = pipeList;
+
+  StreamBuffer_t *stream = NULL;
+
+  Size_t size = zero;
+
+  HalfWord_t span = zero;
+
+
+  while (ISNOTNULLPTR(cursor)) {
+
+
+    stream = cursor->stream;
+
+
+    if (DeviceStateRunning == cursor->device->state) {
+
+
+      if ((PIPE_DEVICE_TO_STREAM == cursor->direction) && (true == cursor->device->available) && (stream->capacity > stream->length)) {
+
+
+        /* An empty ring can start over from the beginning, which gives
+           the device the most contiguous room. */
+        if (zero == stream->length) {
+
+          stream->head = zero;
+
+          stream->tail = zero;
+        }
+
+
+        /* Work out how many free bytes follow the tail before either the end
+           of the ring or the head. */
+        span = (stream->tail >= stream->head) ? (HalfWord_t)(stream->capacity - stream->tail) : (HalfWord_t)(stream->head - stream->tail);
+
+        size = span;
+
+
+        if ((RETURN_SUCCESS == (*cursor->device->read)(cursor->device, &size, &stream->buffer[stream->tail])) && (zero < size) && (span >= size)) {
+
+
+          __StreamCommit__(stream, (HalfWord_t)size);
+
+          cursor->device->bytesRead += size;
+
+          cursor->bytesMoved += size;
+        }
+
+      } else if ((PIPE_STREAM_TO_DEVICE == cursor->direction) && (zero < stream->length)) {
+
+
+        /* Work out how many bytes follow the head before either the end of the
+           ring or the tail. */
+        span = (stream->head < stream->tail) ? (HalfWord_t)(stream->tail - stream->head) : (HalfWord_t)(stream->capacity - stream->head);
+
+        size = span;
+
+
+        if ((RETURN_SUCCESS == (*cursor->device->write)(cursor->device, &size, &stream->buffer[stream->head])) && (zero < size) && (span >= size)) {
+
+
+          __StreamConsume__(stream, (HalfWord_t)size);
+
+          cursor->device->bytesWritten += size;
+
+          cursor->bytesMoved += size;
+        }
+
+      } else {
+        /* Nothing to do here.. Just for MISRA C:2012 compliance. */
+      }
+    }
+
+
+    cursor = cursor->next;
+  }
+
+
+  return;
+}
+
+
+
+/* The __PipeListFind__() function returns RETURN_SUCCESS if the pipe is in the pipe list. */
+static Base_t __PipeListFind__(const Pipe_t *pipe_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Pipe_t *cursor = pipeList;
+
+
+  while ((ISNOTNULLPTR(cursor)) && (cursor != pipe_)) {
+
+    cursor = cursor->next;
+  }
+
+
+  if ((ISNOTNULLPTR(cursor)) && (ISNOTNULLPTR(pipe_))) {
+
+    ret = RETURN_SUCCESS;
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xBroadcastStreamCreate() system call will create a broadcast stream. A broadcast
+   stream is a ring written once and read by up to the specified number of readers, each
+   with its own cursor, so several consumers share one copy of the bytes. */
+BroadcastStream_t *xBroadcastStreamCreate(const HalfWord_t capacity_, const Base_t readers_, const Base_t policy_) {
+
+
+  BroadcastStream_t *ret = NULL;
+
+  Base_t i = zero;
+
+
+  /* Assert if the end-user passed a capacity or number of readers of zero or an
+     unknown policy. */
+  SYSASSERT((zero < capacity_) && (zero < readers_) && ((BROADCAST_STREAM_BACKPRESSURE == policy_) || (BROADCAST_STREAM_OVERWRITE == policy_)));
+
+
+  /* Check if the parameters are valid, if not head toward the exit. */
+  if ((zero < capacity_) && (zero < readers_) && ((BROADCAST_STREAM_BACKPRESSURE == policy_) || (BROADCAST_STREAM_OVERWRITE == policy_))) {
+
+
+    /* Allocate the broadcast stream, its readers and its buffer together. The
+       readers begin immediately after the broadcast stream and the buffer
+       immediately after the readers. */
+    ret = (BroadcastStream_t *)__KernelAllocateMemory__(sizeof(BroadcastStream_t) + (readers_ * sizeof(BroadcastReader_t)) + (capacity_ * sizeof(Byte_t)));
+
+
+    /* Assert if xMemAlloc() didn't return our requested
+       kernel memory. */
+    SYSASSERT(ISNOTNULLPTR(ret));
+
+
+    /* Check if xMemAlloc() returned our requested
+       kernel memory. */
+    if (ISNOTNULLPTR(ret)) {
+
+
+      ret->readers = (BroadcastReader_t *)(ret + 1);
+
+      ret->buffer = (Byte_t *)(ret->readers + readers_);
+
+      ret->capacity = capacity_;
+
+      ret->tail = zero;
+
+      ret->policy = policy_;
+
+      ret->limit = readers_;
+
+
+      for (i = zero; i < readers_; i++) {
+
+        ret->readers[i].active = false;
+      }
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xBroadcastStreamDelete() system call will delete a broadcast stream. */
+void xBroadcastStreamDelete(BroadcastStream_t *stream_) {
+
+
+  /* Assert if the heap fails its health check or if the broadcast stream pointer the
+     end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+
+
+  if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
+
+
+    __KernelFreeMemory__(stream_);
+  }
+
+
+  return;
+}
+
+
+
+/* The xBroadcastStreamAddReader() system call will add a reader to a broadcast stream. The
+   reader only sees bytes sent after it was added. */
+Base_t xBroadcastStreamAddReader(BroadcastStream_t *stream_, Base_t *reader_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Base_t i = zero;
+
+
+  /* Assert if the end-user passed a null reader parameter. */
+  SYSASSERT(ISNOTNULLPTR(reader_));
+
+
+  /* Assert if the heap fails its health check or if the broadcast stream pointer the
+     end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+
+
+  if ((ISNOTNULLPTR(reader_)) && (RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+
+
+    /* Look for an unused reader. */
+    while ((i < stream_->limit) && (true == stream_->readers[i].active)) {
+
+      i++;
+    }
+
+
+    if (i < stream_->limit) {
+
+
+      stream_->readers[i].head = stream_->tail;
+
+      stream_->readers[i].length = zero;
+
+      stream_->readers[i].lost = zero;
+
+      stream_->readers[i].active = true;
+
+      *reader_ = i;
+
+      ret = RETURN_SUCCESS;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xBroadcastStreamRemoveReader() system call will remove a reader from a broadcast
+   stream. The bytes it had not read no longer hold back the writer. */
+Base_t xBroadcastStreamRemoveReader(BroadcastStream_t *stream_, const Base_t reader_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+
+  /* Assert if the broadcast stream or reader is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __BroadcastReaderCheck__(stream_, reader_));
+
+
+  if (RETURN_SUCCESS == __BroadcastReaderCheck__(stream_, reader_)) {
+
+
+    stream_->readers[reader_].active = false;
+
+    ret = RETURN_SUCCESS;
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xBroadcastStreamSend() system call will write bytes to a broadcast stream once for all
+   of its readers. With backpressure only as many bytes as the slowest reader has room for
+   are written. With overwrite every byte is written, up to the capacity, and a reader that
+   falls behind loses its oldest bytes. The number of bytes written is returned. */
+HalfWord_t xBroadcastStreamSend(BroadcastStream_t *stream_, const Byte_t *bytes_, const HalfWord_t length_) {
+
+
+  HalfWord_t ret = zero;
+
+  HalfWord_t space = zero;
+
+  HalfWord_t first = zero;
+
+  HalfWord_t lost = zero;
+
+  Base_t i = zero;
+
+
+  /* Assert if the end-user passed a null byte array or zero bytes. */
+  SYSASSERT((ISNOTNULLPTR(bytes_)) && (zero < length_));
+
+
+  /* Assert if the heap fails its health check or if the broadcast stream pointer the
+     end-user passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+
+
+  if ((ISNOTNULLPTR(bytes_)) && (zero < length_) && (RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+
+
+    space = stream_->capacity;
+
+
+    /* With backpressure the room in the ring is set by the reader with the
+       most bytes still to read. */
+    if (BROADCAST_STREAM_BACKPRESSURE == stream_->policy) {
+
+
+      for (i = zero; i < stream_->limit; i++) {
+
+
+        if ((true == stream_->readers[i].active) && ((stream_->capacity - stream_->readers[i].length) < space)) {
+
+          space = stream_->capacity - stream_->readers[i].length;
+        }
+      }
+    }
+
+
+    ret = (length_ < space) ? length_ : space;
+
+
+    if (zero < ret) {
+
+
+      /* Copy the bytes into the ring in at most two pieces. */
+      first = stream_->capacity - stream_->tail;
+
+
+      if (ret < first) {
+
+        first = ret;
+      }
+
+
+      __memcpy__(&stream_->buffer[stream_->tail], bytes_, first * sizeof(Byte_t));
+
+
+      if (ret > first) {
+
+        __memcpy__(stream_->buffer, &bytes_[first], (ret - first) * sizeof(Byte_t));
+      }
+
+
+      stream_->tail = (HalfWord_t)((stream_->tail + ret) % stream_->capacity);
+
+
+      for (i = zero; i < stream_->limit; i++) {
+
+
+        if (true == stream_->readers[i].active) {
+
+
+          /* A reader that would have more than the capacity to read has
+             been overwritten, so move its head past the lost bytes. */
+          if ((stream_->readers[i].length + ret) > stream_->capacity) {
+
+
+            lost = (HalfWord_t)((stream_->readers[i].length + ret) - stream_->capacity);
+
+            stream_->readers[i].head = (HalfWord_t)((stream_->readers[i].head + lost) % stream_->capacity);
+
+            stream_->readers[i].length = stream_->capacity;
+
+            stream_->readers[i].lost += lost;
+
+          } else {
+
+
+            stream_->readers[i].length += ret;
+          }
+        }
+      }
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xBroadcastStreamReceive() system call will receive up to the specified number of bytes
+   for a reader of a broadcast stream into the end-user's buffer. The other readers are not
+   affected. */
+Base_t xBroadcastStreamReceive(BroadcastStream_t *stream_, const Base_t reader_, Byte_t *bytes_, const HalfWord_t max_, HalfWord_t *received_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  BroadcastReader_t *reader = NULL;
+
+  HalfWord_t length = zero;
+
+  HalfWord_t first = zero;
+
+
+  /* Assert if the end-user passed a null buffer, a zero length buffer or a null
+     received parameter. */
+  SYSASSERT((ISNOTNULLPTR(bytes_)) && (zero < max_) && (ISNOTNULLPTR(received_)));
+
+
+  /* Assert if the broadcast stream or reader is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __BroadcastReaderCheck__(stream_, reader_));
+
+
+  if ((ISNOTNULLPTR(bytes_)) && (zero < max_) && (ISNOTNULLPTR(received_)) && (RETURN_SUCCESS == __BroadcastReaderCheck__(stream_, reader_))) {
+
+
+    reader = &stream_->readers[reader_];
+
+
+    /* If there is nothing to receive then just head toward the exit. */
+    if (zero < reader->length) {
+
+
+      length = (max_ < reader->length) ? max_ : reader->length;
+
+
+      /* Copy the bytes out of the ring in at most two pieces. */
+      first = stream_->capacity - reader->head;
+
+
+      if (length < first) {
+
+        first = length;
+      }
+
+
+      __memcpy__(bytes_, &stream_->buffer[reader->head], first * sizeof(Byte_t));
+
+
+      if (length > first) {
+
+        __memcpy__(&bytes_[first], stream_->buffer, (length - first) * sizeof(Byte_t));
+      }
+
+
+      reader->head = (HalfWord_t)((reader->head + length) % stream_->capacity);
+
+      reader->length -= length;
+
+      *received_ = length;
+
+      ret = RETURN_SUCCESS;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xBroadcastStreamBytesAvailable() system call will return the number of bytes waiting
+   for a reader of a broadcast stream. */
+HalfWord_t xBroadcastStreamBytesAvailable(const BroadcastStream_t *stream_, const Base_t reader_) {
+
+
+  HalfWord_t ret = zero;
+
+
+  /* Assert if the broadcast stream or reader is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __BroadcastReaderCheck__(stream_, reader_));
+
+
+  if (RETURN_SUCCESS == __BroadcastReaderCheck__(stream_, reader_)) {
+
+
+    ret = stream_->readers[reader_].length;
+  }
+
+
+  return ret;
+}
+
+
+
+/* The xBroadcastStreamGetLost() system call will return the number of bytes a reader of a
+   broadcast stream has lost because they were overwritten before it read them. */
+Word_t xBroadcastStreamGetLost(const BroadcastStream_t *stream_, const Base_t reader_) {
+
+
+  Word_t ret = zero;
+
+
+  /* Assert if the broadcast stream or reader is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __BroadcastReaderCheck__(stream_, reader_));
+
+
+  if (RETURN_SUCCESS == __BroadcastReaderCheck__(stream_, reader_)) {
+
+
+    ret = stream_->readers[reader_].lost;
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __BroadcastReaderCheck__() function validates a broadcast stream handle and checks the
+   reader is one that has been added to it. */
+static Base_t __BroadcastReaderCheck__(const BroadcastStream_t *stream_, const Base_t reader_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+
+  if ((RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) && (reader_ < stream_->limit) && (true == stream_->readers[reader_].active)) {
+
+    ret = RETURN_SUCCESS;
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __StreamClear__() function empties a stream. Only the ring indices are reset, the
+   buffer itself is left as is because the bytes in it are no longer reachable. The task
+   waiting on the stream, if any, stays attached but is no longer ready. */
+static void __StreamClear__(const StreamBuffer_t *stream_) {
+
+
+  StreamBuffer_t *stream = (StreamBuffer_t *)stream_;
+
+
+  stream->head = zero;
+
+  stream->tail = zero;
+
+  stream->length = zero;
+
+
+  if (ISNOTNULLPTR(stream->waiter)) {
+
+    stream->waiter->waitReady = false;
+  }
+
+
+  return;
+}
+
+
+
+/* The __StreamReadInto__() function does the work for xStreamReceiveInto() and
+   xStreamPeekInto(). It validates the parameters and the stream once and copies as many
+   of the waiting bytes as fit in the end-user's buffer. */
+static Base_t __StreamReadInto__(const StreamBuffer_t *stream_, Byte_t *bytes_, const HalfWord_t max_, HalfWord_t *received_, const Base_t consume_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  HalfWord_t length = zero;
+
+
+  /* Assert if the end-user passed a null buffer, a zero length buffer or a null
+     received parameter. */
+  SYSASSERT((ISNOTNULLPTR(bytes_)) && (zero < max_) && (ISNOTNULLPTR(received_)));
+
+
+  /* Assert if the heap fails its health check or if the stream pointer the end-user
+     passed is invalid. */
+  SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+
+
+
+  /* Check if the parameters are valid and the stream pointer the end-user passed is
+     valid. If so, continue. Otherwise, head toward the exit. */
+  if ((ISNOTNULLPTR(bytes_)) && (zero < max_) && (ISNOTNULLPTR(received_)) &&
+      (RETURN_SUCCESS == __MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+
+
+    /* If there is nothing to receive then just head toward the exit. */
+    if (zero < stream_->length) {
+
+
+      length = (max_ < stream_->length) ? max_ : stream_->length;
+
+      __StreamRead__(stream_, bytes_, length, consume_);
+
+      *received_ = length;
+
+      ret = RETURN_SUCCESS;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __StreamRead__() function copies the specified number of bytes from the head of a
+   stream and, if asked to, consumes them. The bytes may wrap around the end of the ring,
+   in which case they are copied in two pieces. The caller must make sure the stream holds
+   at least the number of bytes requested. */
+static void __StreamRead__(const StreamBuffer_t *stream_, Byte_t *bytes_, const HalfWord_t length_, const Base_t consume_) {
+
+
+  StreamBuffer_t *stream = (StreamBuffer_t *)stream_;
+
+  HalfWord_t first = zero;
+
+
+  /* Work out how many bytes can be copied before the end of the ring. */
+  first = stream->capacity - stream->head;
+
+
+  if (length_ < first) {
+
+    first = length_;
+  }
+
+
+  __memcpy__(bytes_, &stream->buffer[stream->head], first * sizeof(Byte_t));
+
+
+  /* Copy the rest from the start of the ring if the bytes wrap. */
+  if (length_ > first) {
+
+    __memcpy__(&bytes_[first], stream->buffer, (length_ - first) * sizeof(Byte_t));
+  }
+
+
+  if (true == consume_) {
+
+    __StreamConsume__(stream, length_);
+  }
+
+
+  return;
+}
+
+
+
+/* The __StreamConsume__() function drops the specified number of bytes from the head
+   of a stream once they have been read. */
+static void __StreamConsume__(StreamBuffer_t *stream_, const HalfWord_t length_) {
+
+
+  stream_->head = (HalfWord_t)((stream_->head + length_) % stream_->capacity);
+
+  stream_->length -= length_;
+
+
+  /* The task waiting on the stream is only ready while enough bytes remain. */
+  if ((ISNOTNULLPTR(stream_->waiter)) && (stream_->waiter->waitBytes > stream_->length)) {
+
+    stream_->waiter->waitReady = false;
+  }
+
+
+  return;
+}
+
+
+
+/* The __StreamWrite__() function copies the specified number of bytes to the tail of a
+   stream. The bytes may wrap around the end of the ring, in which case they are copied
+   in two pieces. The caller must make sure the stream has room for the bytes. */
+static void __StreamWrite__(StreamBuffer_t *stream_, const Byte_t *bytes_, const HalfWord_t length_) {
+
+
+  HalfWord_t first = zero;
+
+
+  /* Work out how many bytes can be copied before the end of the ring. */
+  first = stream_->capacity - stream_->tail;
+
+
+  if (length_ < first) {
+
+    first = length_;
+  }
+
+
+  __memcpy__(&stream_->buffer[stream_->tail], bytes_, first * sizeof(Byte_t));
+
+
+  /* Copy the rest to the start of the ring if the bytes wrap. */
+  if (length_ > first) {
+
+    __memcpy__(stream_->buffer, &bytes_[first], (length_ - first) * sizeof(Byte_t));
+  }
+
+
+  __StreamCommit__(stream_, length_);
+
+
+  return;
+}
+
+
+
+/* The __StreamCommit__() function adds the specified number of bytes, already written
+   at the tail of a stream, to the stream. */
+static void __StreamCommit__(StreamBuffer_t *stream_, const HalfWord_t length_) {
+
+
+  Char_t notification[CONFIG_NOTIFICATION_VALUE_BYTES];
+
+
+  stream_->tail = (HalfWord_t)((stream_->tail + length_) % stream_->capacity);
+
+  stream_->length += length_;
+
+
+  /* Notify the trigger task if this write took the stream from below its
+     trigger level to at or above it. */
+  if ((ISNOTNULLPTR(stream_->triggerTask)) && (stream_->triggerLevel <= stream_->length) && (stream_->triggerLevel > (stream_->length - length_))) {
+
+
+    __memset__(notification, zero, CONFIG_NOTIFICATION_VALUE_BYTES);
+
+    notification[0] = STREAM_TRIGGER_NOTIFICATION;
+
+
+    /* If the task already has a notification waiting, xTaskNotifyGive() will
+       leave it in place. */
+    xTaskNotifyGive(stream_->triggerTask, 0x1u, notification);
+  }
+
+
+  if (stream_->length > stream_->highWater) {
+
+    stream_->highWater = stream_->length;
+  }
+
+
+  /* Ready the task waiting on the stream once the number of bytes it
+     is waiting for have arrived. */
+  if ((ISNOTNULLPTR(stream_->waiter)) && (stream_->waiter->waitBytes <= stream_->length)) {
+
+    stream_->waiter->waitReady = true;
+  }
+
+
+  return;
+}
+
+
+
+/* The __MessageBufferCheck__() function validates a message buffer handle by checking its
+   kernel memory entry. */
+static Base_t __MessageBufferCheck__(const MessageBuffer_t *buffer_) {
+
+
+  return __MemoryRegionCheckKernel__(buffer_, MEMORY_REGION_CHECK_OPTION_W_ADDR);
+}
+
+
+
+/* The __MessageBufferReserve__() function finds room for a frame in the stream's ring. A
+   frame is always contiguous so it can be built and read in place. If the frame doesn't fit
+   before the end of the ring, the rest of the ring is skipped and the frame starts at the
+   beginning. The skipped bytes are marked with MESSAGE_BUFFER_WRAP when there is room for a
+   length prefix, otherwise the reader skips them because no prefix fits there. */
+static Byte_t *__MessageBufferReserve__(MessageBuffer_t *buffer_, const HalfWord_t bytes_) {
+
+
+  Byte_t *ret = NULL;
+
+  StreamBuffer_t *stream = buffer_->stream;
+
+  HalfWord_t offset = zero;
+
+  HalfWord_t pad = zero;
+
+
+  if (false == buffer_->reserved) {
+
+
+    /* An empty ring can start over from the beginning, which gives the
+       most contiguous room. */
+    if (zero == stream->length) {
+
+      stream->head = zero;
+
+      stream->tail = zero;
+    }
+
+
+    offset = stream->tail;
+
+
+    if ((Size_t)(stream->capacity - offset) < (MESSAGE_BUFFER_HEADER_BYTES + bytes_)) {
+
+      pad = stream->capacity - offset;
+
+      offset = zero;
+    }
+
+
+    if ((pad + MESSAGE_BUFFER_HEADER_BYTES + bytes_) <= (Size_t)(stream->capacity - stream->length)) {
+
+
+      buffer_->reserveOffset = offset;
+
+      buffer_->reservePad = pad;
+
+      buffer_->reserveBytes = bytes_;
+
+      buffer_->reserved = true;
+
+      ret = &stream->buffer[offset + MESSAGE_BUFFER_HEADER_BYTES];
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __MessageBufferCommit__() function writes the length prefix of the reserved frame, and
+   the wrap marker if one is needed, and hands the frame to the reader. */
+static void __MessageBufferCommit__(MessageBuffer_t *buffer_, const HalfWord_t bytes_) {
+
+
+  StreamBuffer_t *stream = buffer_->stream;
+
+  HalfWord_t header = MESSAGE_BUFFER_WRAP;
+
+
+  if (MESSAGE_BUFFER_HEADER_BYTES <= buffer_->reservePad) {
+
+    __memcpy__(&stream->buffer[stream->tail], &header, MESSAGE_BUFFER_HEADER_BYTES);
+  }
+
+
+  header = bytes_;
+
+  __memcpy__(&stream->buffer[buffer_->reserveOffset], &header, MESSAGE_BUFFER_HEADER_BYTES);
+
+
+  stream->tail = (HalfWord_t)((buffer_->reserveOffset + MESSAGE_BUFFER_HEADER_BYTES + bytes_) % stream->capacity);
+
+  stream->length += (HalfWord_t)(buffer_->reservePad + MESSAGE_BUFFER_HEADER_BYTES + bytes_);
+
+
+  if (stream->length > stream->highWater) {
+
+    stream->highWater = stream->length;
+  }
+
+
+  buffer_->frames++;
+
+  buffer_->frameBytes += bytes_;
+
+  buffer_->reserved = false;
+
+
+  return;
+}
+
+
+
+/* The __MessageBufferAcquire__() function finds the next frame in the stream's ring,
+   skipping the end of the ring the same way __MessageBufferReserve__() did. */
+static Byte_t *__MessageBufferAcquire__(MessageBuffer_t *buffer_, HalfWord_t *bytes_) {
+
+
+  Byte_t *ret = NULL;
+
+  StreamBuffer_t *stream = buffer_->stream;
+
+  HalfWord_t offset = zero;
+
+  HalfWord_t skip = zero;
+
+  HalfWord_t header = zero;
+
+
+  if ((false == buffer_->acquired) && (zero < buffer_->frames)) {
+
+
+    offset = stream->head;
+
+
+    if ((Size_t)(stream->capacity - offset) >= MESSAGE_BUFFER_HEADER_BYTES) {
+
+      __memcpy__(&header, &stream->buffer[offset], MESSAGE_BUFFER_HEADER_BYTES);
+    }
+
+
+    if (((Size_t)(stream->capacity - offset) < MESSAGE_BUFFER_HEADER_BYTES) || (MESSAGE_BUFFER_WRAP == header)) {
+
+
+      skip = stream->capacity - offset;
+
+      offset = zero;
+
+      __memcpy__(&header, stream->buffer, MESSAGE_BUFFER_HEADER_BYTES);
+    }
+
+
+    buffer_->acquireOffset = offset;
+
+    buffer_->acquireSkip = skip;
+
+    buffer_->acquireBytes = header;
+
+    buffer_->acquired = true;
+
+    *bytes_ = header;
+
+    ret = &stream->buffer[offset + MESSAGE_BUFFER_HEADER_BYTES];
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __MessageBufferRelease__() function consumes the acquired frame. */
+static void __MessageBufferRelease__(MessageBuffer_t *buffer_) {
+
+
+  StreamBuffer_t *stream = buffer_->stream;
+
+
+  stream->head = (HalfWord_t)((buffer_->acquireOffset + MESSAGE_BUFFER_HEADER_BYTES + buffer_->acquireBytes) % stream->capacity);
+
+  stream->length -= (HalfWord_t)(buffer_->acquireSkip + MESSAGE_BUFFER_HEADER_BYTES + buffer_->acquireBytes);
+
+  buffer_->frames--;
+
+  buffer_->frameBytes -= buffer_->acquireBytes;
+
+  buffer_->acquired = false;
+
+
+  return;
+}
+
+
+
+#if defined(POSIX_ARCH_OTHER)
+void __StreamStateClear__(void) {
+
+  pipeList = NULL;
+
+  triggerList = NULL;
+
+  return;
+}
+#endif
@@ -42,13 +42,46 @@ extern "C" {
 #endif
 
 StreamBuffer_t *xStreamCreate(void);
+StreamBuffer_t *xStreamCreateEx(const HalfWord_t capacity_);
+HalfWord_t xStreamGetHighWater(const StreamBuffer_t *stream_);
+Base_t xStreamSetTriggerLevel(StreamBuffer_t *stream_, const HalfWord_t level_, Task_t *task_);
 void xStreamDelete(const StreamBuffer_t *stream_);
 Base_t xStreamSend(StreamBuffer_t *stream_, const Byte_t byte_);
+HalfWord_t xStreamSendBytes(StreamBuffer_t *stream_, const Byte_t *bytes_, const HalfWord_t length_, const Base_t mode_);
 Byte_t *xStreamReceive(const StreamBuffer_t *stream_, HalfWord_t *bytes_);
+Base_t xStreamReceiveInto(const StreamBuffer_t *stream_, Byte_t *bytes_, const HalfWord_t max_, HalfWord_t *received_);
+Base_t xStreamPeekInto(const StreamBuffer_t *stream_, Byte_t *bytes_, const HalfWord_t max_, HalfWord_t *received_);
 HalfWord_t xStreamBytesAvailable(const StreamBuffer_t *stream_);
 void xStreamReset(const StreamBuffer_t *stream_);
 Base_t xStreamIsEmpty(const StreamBuffer_t *stream_);
 Base_t xStreamIsFull(const StreamBuffer_t *stream_);
+MessageBuffer_t *xMessageBufferCreate(const HalfWord_t capacity_);
+void xMessageBufferDelete(MessageBuffer_t *buffer_);
+Base_t xMessageBufferSend(MessageBuffer_t *buffer_, const HalfWord_t bytes_, const Byte_t *value_);
+Base_t xMessageBufferReceive(MessageBuffer_t *buffer_, Byte_t *value_, const HalfWord_t max_, HalfWord_t *received_);
+Byte_t *xMessageBufferReserve(MessageBuffer_t *buffer_, const HalfWord_t bytes_);
+Base_t xMessageBufferCommit(MessageBuffer_t *buffer_, const HalfWord_t bytes_);
+Byte_t *xMessageBufferAcquire(MessageBuffer_t *buffer_, HalfWord_t *bytes_);
+Base_t xMessageBufferRelease(MessageBuffer_t *buffer_);
+HalfWord_t xMessageBufferGetFrames(const MessageBuffer_t *buffer_);
+HalfWord_t xMessageBufferGetBytes(const MessageBuffer_t *buffer_);
+Pipe_t *xPipeCreate(const HalfWord_t uid_, StreamBuffer_t *stream_, const Base_t direction_);
+void xPipeDelete(Pipe_t *pipe_);
+Word_t xPipeGetBytesMoved(const Pipe_t *pipe_);
+void __PipeService__(void);
+void __StreamTriggerDetach__(const Task_t *task_);
+BroadcastStream_t *xBroadcastStreamCreate(const HalfWord_t capacity_, const Base_t readers_, const Base_t policy_);
+void xBroadcastStreamDelete(BroadcastStream_t *stream_);
+Base_t xBroadcastStreamAddReader(BroadcastStream_t *stream_, Base_t *reader_);
+Base_t xBroadcastStreamRemoveReader(BroadcastStream_t *stream_, const Base_t reader_);
+HalfWord_t xBroadcastStreamSend(BroadcastStream_t *stream_, const Byte_t *bytes_, const HalfWord_t length_);
+Base_t xBroadcastStreamReceive(BroadcastStream_t *stream_, const Base_t reader_, Byte_t *bytes_, const HalfWord_t max_, HalfWord_t *received_);
+HalfWord_t xBroadcastStreamBytesAvailable(const BroadcastStream_t *stream_, const Base_t reader_);
+Word_t xBroadcastStreamGetLost(const BroadcastStream_t *stream_, const Base_t reader_);
+
+#if defined(POSIX_ARCH_OTHER)
+void __StreamStateClear__(void);
+#endif
 
 #ifdef __cplusplus
 }
@@ -32,6 +32,7 @@ static TaskList_t *taskList = NULL;
 static void __RunTimeReset__(void);
 static void __TaskRun__(Task_t *task_);
 static Base_t __TaskListFindTask__(const Task_t *task_);
+static Base_t __TaskWaitIsReady__(const Task_t *task_);
 
 /* Declare and initialize the scheduler state to
    running. This is controlled with xTaskResumeAll()
@@ -106,6 +107,16 @@ Task_t *xTaskCreate(const Char_t *name_, void (*callback_)(Task_t *task_, TaskPa
 
         ret->taskParameter = taskParameter_;
 
+        ret->queueSet = NULL;
+
+        ret->waitCondition = TaskWaitConditionNone;
+
+        ret->waitObject = NULL;
+
+        ret->waitBytes = zero;
+
+        ret->waitReady = false;
+
         ret->next = NULL;
 
         cursor = taskList->head;
@@ -178,6 +189,24 @@ void xTaskDelete(const Task_t *task_) {
         taskList->head = cursor->next;
 
 
+        /* Detach the task's queue set so it doesn't point at a freed task. */
+        if (ISNOTNULLPTR(cursor->queueSet)) {
+
+          cursor->queueSet->task = NULL;
+        }
+
+
+        /* Release the object the task is waiting on for the same reason. */
+        __TaskWaitDetach__(cursor);
+
+
+        /* Stop the memory regions from notifying the task at their watermark. */
+        __MemoryWatermarkDetach__(cursor);
+
+
+        /* Stop streams from notifying the task at their trigger level. */
+        __StreamTriggerDetach__(cursor);
+
 
         __KernelFreeMemory__(cursor);
 
@@ -208,6 +237,23 @@ void xTaskDelete(const Task_t *task_) {
           taskPrevious->next = cursor->next;
 
 
+          /* Detach the task's queue set so it doesn't point at a freed task. */
+          if (ISNOTNULLPTR(cursor->queueSet)) {
+
+            cursor->queueSet->task = NULL;
+          }
+
+
+          /* Release the object the task is waiting on for the same reason. */
+          __TaskWaitDetach__(cursor);
+
+
+          /* Stop the memory regions from notifying the task at their watermark. */
+          __MemoryWatermarkDetach__(cursor);
+
+
+          /* Stop streams from notifying the task at their trigger level. */
+          __StreamTriggerDetach__(cursor);
 
 
           __KernelFreeMemory__(cursor);
@@ -952,6 +998,194 @@ void xTaskWait(Task_t *task_) {
 
 
 
+/* The xTaskWaitOn() system call will place a task in the waiting state until the object it
+   waits on is ready. Queues and streams ready their waiting task directly when they are sent
+   to, so a waiting task costs the scheduler nothing until then. */
+Base_t xTaskWaitOn(Task_t *task_, const TaskWaitCondition_t condition_, Addr_t *object_, const HalfWord_t value_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+  Addr_t *object = NULL;
+
+  Base_t ready = false;
+
+
+  /* Assert if the task cannot be found. */
+  SYSASSERT(RETURN_SUCCESS == __TaskListFindTask__(task_));
+
+
+  /* Check if the task can be found. */
+  if (RETURN_SUCCESS == __TaskListFindTask__(task_)) {
+
+
+    /* Release whatever the task was waiting on before. */
+    __TaskWaitDetach__(task_);
+
+
+    if (TaskWaitConditionNone == condition_) {
+
+
+      ret = RETURN_SUCCESS;
+
+
+      /* An object may only have one waiting task. */
+    } else if ((TaskWaitConditionQueueNotEmpty == condition_) && (RETURN_SUCCESS == __MemoryRegionCheckKernel__(object_, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK)) && (ISNULLPTR(((Queue_t *)object_)->waiter))) {
+
+
+      ((Queue_t *)object_)->waiter = task_;
+
+      object = object_;
+
+      ready = (zero < ((Queue_t *)object_)->length) ? true : false;
+
+      ret = RETURN_SUCCESS;
+
+    } else if ((TaskWaitConditionStreamBytes == condition_) && (zero < value_) && (RETURN_SUCCESS == __MemoryRegionCheckKernel__(object_, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK)) && (ISNULLPTR(((StreamBuffer_t *)object_)->waiter))) {
+
+
+      ((StreamBuffer_t *)object_)->waiter = task_;
+
+      object = object_;
+
+      ready = (value_ <= ((StreamBuffer_t *)object_)->length) ? true : false;
+
+      ret = RETURN_SUCCESS;
+
+    } else if ((TaskWaitConditionTimerExpired == condition_) && (RETURN_SUCCESS == __MemoryRegionCheckKernel__(object_, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK)) && (ISNULLPTR(((Timer_t *)object_)->waiter))) {
+
+
+      ((Timer_t *)object_)->waiter = task_;
+
+      object = object_;
+
+      ret = RETURN_SUCCESS;
+
+
+      /* A device is found once here by its unique identifier so the
+         scheduler does not search the device list. */
+    } else if (TaskWaitConditionDeviceAvailable == condition_) {
+
+
+      object = (Addr_t *)__DeviceListFind__(value_);
+
+
+      if (ISNOTNULLPTR(object)) {
+
+        ret = RETURN_SUCCESS;
+      }
+
+    } else {
+      /* Nothing to do here.. Just for MISRA C:2012 compliance. */
+    }
+
+
+    /* Assert if the object could not be waited on. */
+    SYSASSERT(RETURN_SUCCESS == ret);
+
+
+    if ((RETURN_SUCCESS == ret) && (TaskWaitConditionNone != condition_)) {
+
+
+      task_->waitCondition = condition_;
+
+      task_->waitObject = object;
+
+      task_->waitBytes = value_;
+
+      task_->waitReady = ready;
+
+      task_->state = TaskStateWaiting;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __TaskWaitDetach__() function releases the object a task is waiting on. It is called
+   when the task waits on something else or when either the task or the object is deleted. */
+void __TaskWaitDetach__(Task_t *task_) {
+
+
+  if ((TaskWaitConditionQueueNotEmpty == task_->waitCondition) && (ISNOTNULLPTR(task_->waitObject))) {
+
+
+    ((Queue_t *)task_->waitObject)->waiter = NULL;
+
+  } else if ((TaskWaitConditionStreamBytes == task_->waitCondition) && (ISNOTNULLPTR(task_->waitObject))) {
+
+
+    ((StreamBuffer_t *)task_->waitObject)->waiter = NULL;
+
+  } else if ((TaskWaitConditionTimerExpired == task_->waitCondition) && (ISNOTNULLPTR(task_->waitObject))) {
+
+
+    ((Timer_t *)task_->waitObject)->waiter = NULL;
+
+  } else {
+    /* Nothing to do here.. Just for MISRA C:2012 compliance. */
+  }
+
+
+  task_->waitCondition = TaskWaitConditionNone;
+
+  task_->waitObject = NULL;
+
+  task_->waitBytes = zero;
+
+  task_->waitReady = false;
+
+
+  return;
+}
+
+
+
+/* The __TaskWaitIsReady__() function returns true if the object a waiting task is waiting on
+   is ready. Queues and streams set the task's ready flag themselves, timers and devices have
+   no sender so their state is read directly. */
+static Base_t __TaskWaitIsReady__(const Task_t *task_) {
+
+
+  Base_t ret = false;
+
+  Timer_t *timer = NULL;
+
+
+  if ((TaskWaitConditionQueueNotEmpty == task_->waitCondition) || (TaskWaitConditionStreamBytes == task_->waitCondition)) {
+
+
+    ret = task_->waitReady;
+
+  } else if (TaskWaitConditionTimerExpired == task_->waitCondition) {
+
+
+    timer = (Timer_t *)task_->waitObject;
+
+
+    if ((TimerStateRunning == timer->state) && (zero < timer->timerPeriod) && ((__SysGetSysTicks__() - timer->timerStartTime) > timer->timerPeriod)) {
+
+      ret = true;
+    }
+
+  } else if (TaskWaitConditionDeviceAvailable == task_->waitCondition) {
+
+
+    ret = ((Device_t *)task_->waitObject)->available;
+
+  } else {
+    /* Nothing to do here.. Just for MISRA C:2012 compliance. */
+  }
+
+
+  return ret;
+}
+
+
+
 /* The xTaskChangePeriod() system call will change the period (ticks) on the task timer
    for the specified task. The timer period must be greater than zero. To have any effect, the task
    must be in the waiting state set by calling xTaskWait() on the task. Once the timer period is set
@@ -1023,6 +1257,17 @@ Ticks_t xTaskGetPeriod(const Task_t *task_) {
 
 
 
+/* The __TaskCheck__() function is used by the other kernel modules to validate a task
+   handle before they keep or change it. It returns RETURN_SUCCESS if the task is in the
+   task list. */
+Base_t __TaskCheck__(const Task_t *task_) {
+
+
+  return __TaskListFindTask__(task_);
+}
+
+
+
 /* __TaskListFindTask__() is used to search the task list for a
    task and returns RETURN_SUCCESS if the task is found. It also
    always checks the health of the heap by calling __MemoryRegionCheckKernel__(). */
@@ -1151,6 +1396,14 @@ void xTaskStartScheduler(void) {
       }
 
 
+      /* Move bytes through the pipes between devices and streams. */
+      __PipeService__();
+
+
+      /* Call the callbacks of the timers that have expired. */
+      __TimerService__();
+
+
       cursor = taskList->head;
 
       /* While the task cursor is not null (i.e., there are further tasks in the task list). */
@@ -1162,6 +1415,16 @@ void xTaskStartScheduler(void) {
 
           __TaskRun__(cursor);
 
+          /* If the task pointed to by the task cursor is waiting and a queue in its queue set has a message waiting, then execute it. */
+        } else if ((TaskStateWaiting == cursor->state) && (ISNOTNULLPTR(cursor->queueSet)) && (zero < cursor->queueSet->ready)) {
+
+          __TaskRun__(cursor);
+
+          /* If the task pointed to by the task cursor is waiting and the object it is waiting on is ready, then execute it. */
+        } else if ((TaskStateWaiting == cursor->state) && (TaskWaitConditionNone != cursor->waitCondition) && (true == __TaskWaitIsReady__(cursor))) {
+
+          __TaskRun__(cursor);
+
           /* If the task pointed to by the task cursor is waiting and its timer has expired, then execute it. */
         } else if ((TaskStateWaiting == cursor->state) && (zero < cursor->timerPeriod) && ((__SysGetSysTicks__() - cursor->timerStartTime) > cursor->timerPeriod)) {
 
@@ -1194,6 +1457,13 @@ void xTaskStartScheduler(void) {
         __TaskRun__(runTask);
 
         runTask = NULL;
+
+      } else {
+
+
+        /* There are no running tasks so use the idle time to slide one unlocked
+           movable allocation toward the start of the heap. */
+        __HeapCompactMemory__();
       }
 
       /* Underflow unsigned least runtime to get maximum value */
@@ -60,6 +60,9 @@ TaskNotification_t *xTaskNotifyTake(Task_t *task_);
 void xTaskResume(Task_t *task_);
 void xTaskSuspend(Task_t *task_);
 void xTaskWait(Task_t *task_);
+Base_t xTaskWaitOn(Task_t *task_, const TaskWaitCondition_t condition_, Addr_t *object_, const HalfWord_t value_);
+void __TaskWaitDetach__(Task_t *task_);
+Base_t __TaskCheck__(const Task_t *task_);
 void xTaskChangePeriod(Task_t *task_, const Ticks_t timerPeriod_);
 Ticks_t xTaskGetPeriod(const Task_t *task_);
 void xTaskResetTimer(Task_t *task_);
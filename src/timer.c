@@ -31,7 +31,12 @@
 
 /* Declare and initialize the task list to null. */
 static TimerList_t *timerList = NULL;
-static Base_t __TimerListFindTimer__(const Timer_t *timer_);
+static Base_t __TimerCheck__(const Timer_t *timer_);
+static void __TimerWheelInsert__(Timer_t *timer_, const Ticks_t now_);
+static void __TimerWheelRemove__(Timer_t *timer_);
+static void __TimerExpiredAppend__(Timer_t *timer_, const Base_t list_);
+static void __TimerWheelCascade__(const Base_t level_, const Base_t slot_);
+static void __TimerWheelAdvance__(void);
 
 
 
@@ -54,6 +59,14 @@ Timer_t *xTimerCreate(const Ticks_t timerPeriod_) {
 
 
     timerList = (TimerList_t *)__KernelAllocateMemory__(sizeof(TimerList_t));
+
+
+    /* The timer wheel starts at the current time. The rest of the timer
+       list is zeroed by the allocation. */
+    if (ISNOTNULLPTR(timerList)) {
+
+      timerList->wheelNow = __SysGetSysTicks__();
+    }
   }
 
 
@@ -84,6 +97,26 @@ Timer_t *xTimerCreate(const Ticks_t timerPeriod_) {
 
       ret->timerStartTime = __SysGetSysTicks__();
 
+      ret->deadline = zero;
+
+      ret->magic = TIMER_MAGIC;
+
+      ret->wheelLevel = zero;
+
+      ret->wheelSlot = NULL;
+
+      ret->wheelNext = NULL;
+
+      ret->wheelPrevious = NULL;
+
+      ret->oneShot = false;
+
+      ret->timerParameter = NULL;
+
+      ret->callback = NULL;
+
+      ret->waiter = NULL;
+
       ret->next = NULL;
 
       cursor = timerList->head;
@@ -128,11 +161,11 @@ void xTimerDelete(const Timer_t *timer_) {
 
   /* Assert if the timer cannot be found in the timer
      list. */
-  SYSASSERT(RETURN_SUCCESS == __TimerListFindTimer__(timer_));
+  SYSASSERT(RETURN_SUCCESS == __TimerCheck__(timer_));
 
 
   /* Check if the timer was found in the timer list. */
-  if (RETURN_SUCCESS == __TimerListFindTimer__(timer_)) {
+  if (RETURN_SUCCESS == __TimerCheck__(timer_)) {
 
 
 
@@ -147,8 +180,17 @@ void xTimerDelete(const Timer_t *timer_) {
 
       timerList->head = cursor->next;
 
+      __TimerWheelRemove__(cursor);
+
 
+      /* Release a task waiting on the timer so it doesn't point at a freed timer. */
+      if (ISNOTNULLPTR(cursor->waiter)) {
 
+        __TaskWaitDetach__(cursor->waiter);
+      }
+
+
+      cursor->magic = zero;
 
       __KernelFreeMemory__(cursor);
 
@@ -180,8 +222,17 @@ void xTimerDelete(const Timer_t *timer_) {
 
         timerPrevious->next = cursor->next;
 
+        __TimerWheelRemove__(cursor);
+
+
+        /* Release a task waiting on the timer so it doesn't point at a freed timer. */
+        if (ISNOTNULLPTR(cursor->waiter)) {
+
+          __TaskWaitDetach__(cursor->waiter);
+        }
 
 
+        cursor->magic = zero;
 
         __KernelFreeMemory__(cursor);
 
@@ -205,13 +256,20 @@ void xTimerChangePeriod(Timer_t *timer_, const Ticks_t timerPeriod_) {
 
 
   /* Assert if the timer cannot be found in the timer list. */
-  SYSASSERT(RETURN_SUCCESS == __TimerListFindTimer__(timer_));
+  SYSASSERT(RETURN_SUCCESS == __TimerCheck__(timer_));
 
 
   /* Check if the timer was found in the timer list. */
-  if (RETURN_SUCCESS == __TimerListFindTimer__(timer_)) {
+  if (RETURN_SUCCESS == __TimerCheck__(timer_)) {
 
     timer_->timerPeriod = timerPeriod_;
+
+
+    /* Move a running timer to the slot for its new deadline. */
+    if (TimerStateRunning == timer_->state) {
+
+      __TimerWheelInsert__(timer_, __SysGetSysTicks__());
+    }
   }
 
 
@@ -229,10 +287,10 @@ Ticks_t xTimerGetPeriod(const Timer_t *timer_) {
 
 
   /* Assert if the timer cannot be found in the timer list. */
-  SYSASSERT(RETURN_SUCCESS == __TimerListFindTimer__(timer_));
+  SYSASSERT(RETURN_SUCCESS == __TimerCheck__(timer_));
 
   /* Check if the timer was found in the timer list. */
-  if (RETURN_SUCCESS == __TimerListFindTimer__(timer_)) {
+  if (RETURN_SUCCESS == __TimerCheck__(timer_)) {
 
     ret = timer_->timerPeriod;
   }
@@ -253,10 +311,10 @@ Base_t xTimerIsTimerActive(const Timer_t *timer_) {
 
 
   /* Assert if the timer cannot be found in the timer list. */
-  SYSASSERT(RETURN_SUCCESS == __TimerListFindTimer__(timer_));
+  SYSASSERT(RETURN_SUCCESS == __TimerCheck__(timer_));
 
   /* Check if the timer was found in the timer list. */
-  if (RETURN_SUCCESS == __TimerListFindTimer__(timer_)) {
+  if (RETURN_SUCCESS == __TimerCheck__(timer_)) {
 
     /* Check if the timer state is running, if so
        return true. */
@@ -283,11 +341,11 @@ Base_t xTimerHasTimerExpired(const Timer_t *timer_) {
 
 
   /* Assert if the timer cannot be found in the timer list. */
-  SYSASSERT(RETURN_SUCCESS == __TimerListFindTimer__(timer_));
+  SYSASSERT(RETURN_SUCCESS == __TimerCheck__(timer_));
 
 
   /* Check if the timer was found in the timer list. */
-  if (RETURN_SUCCESS == __TimerListFindTimer__(timer_)) {
+  if (RETURN_SUCCESS == __TimerCheck__(timer_)) {
 
 
     /* Assert if the timer isn't running, it must be for the
@@ -323,14 +381,21 @@ void xTimerReset(Timer_t *timer_) {
 
 
   /* Assert if the timer cannot be found in the timer list. */
-  SYSASSERT(RETURN_SUCCESS == __TimerListFindTimer__(timer_));
+  SYSASSERT(RETURN_SUCCESS == __TimerCheck__(timer_));
 
 
 
   /* Check if the timer was found in the timer list. */
-  if (RETURN_SUCCESS == __TimerListFindTimer__(timer_)) {
+  if (RETURN_SUCCESS == __TimerCheck__(timer_)) {
 
     timer_->timerStartTime = __SysGetSysTicks__();
+
+
+    /* Move a running timer to the slot for its new deadline. */
+    if (TimerStateRunning == timer_->state) {
+
+      __TimerWheelInsert__(timer_, __SysGetSysTicks__());
+    }
   }
 
   return;
@@ -346,14 +411,16 @@ void xTimerStart(Timer_t *timer_) {
 
 
   /* Assert if the timer cannot be found in the timer list. */
-  SYSASSERT(RETURN_SUCCESS == __TimerListFindTimer__(timer_));
+  SYSASSERT(RETURN_SUCCESS == __TimerCheck__(timer_));
 
 
 
   /* Check if the timer was found in the timer list. */
-  if (RETURN_SUCCESS == __TimerListFindTimer__(timer_)) {
+  if (RETURN_SUCCESS == __TimerCheck__(timer_)) {
 
     timer_->state = TimerStateRunning;
+
+    __TimerWheelInsert__(timer_, __SysGetSysTicks__());
   }
 
 
@@ -370,13 +437,15 @@ void xTimerStop(Timer_t *timer_) {
 
 
   /* Assert if the timer cannot be found in the timer list. */
-  SYSASSERT(RETURN_SUCCESS == __TimerListFindTimer__(timer_));
+  SYSASSERT(RETURN_SUCCESS == __TimerCheck__(timer_));
 
 
   /* Check if the timer was found in the timer list. */
-  if (RETURN_SUCCESS == __TimerListFindTimer__(timer_)) {
+  if (RETURN_SUCCESS == __TimerCheck__(timer_)) {
 
     timer_->state = TimerStateSuspended;
+
+    __TimerWheelRemove__(timer_);
   }
 
 
@@ -386,18 +455,460 @@ void xTimerStop(Timer_t *timer_) {
 
 
 
-/* __TimerListFindTimer__() is used to search the timer list for a
-   timer and returns RETURN_SUCCESS if the timer is found. It also
-   always checks the health of the heap by calling __MemoryRegionCheckKernel__(). */
-static Base_t __TimerListFindTimer__(const Timer_t *timer_) {
+/* The xTimerCreateCallback() system call will create a new timer that calls a callback
+   when it expires. The callback is called by the scheduler so no task has to poll the timer.
+   A one-shot timer is stopped after its callback is called while an auto-reload timer is
+   started again from the time it expired rather than from the time the callback was called,
+   so an auto-reload timer does not drift. Like timers created by xTimerCreate(), the timer
+   must be started with xTimerStart() and its memory must be freed by xTimerDelete(). */
+Timer_t *xTimerCreateCallback(const Ticks_t timerPeriod_, const Base_t oneShot_, void (*callback_)(Timer_t *timer_, TimerParm_t *parm_), TimerParm_t *timerParameter_) {
 
 
-  Base_t ret = RETURN_FAILURE;
+  Timer_t *ret = NULL;
+
+
+  /* Assert if the callback is null. */
+  SYSASSERT(ISNOTNULLPTR(callback_));
+
+
+  /* Check if the callback is not null. */
+  if (ISNOTNULLPTR(callback_)) {
+
+
+    ret = xTimerCreate(timerPeriod_);
+
+
+    if (ISNOTNULLPTR(ret)) {
+
+
+      ret->oneShot = oneShot_;
+
+      ret->timerParameter = timerParameter_;
+
+      ret->callback = callback_;
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __TimerService__() function is called by the scheduler on every pass. It moves the timer
+   wheel up to the current time and calls the callback of each timer with a callback that
+   has expired, in the order the timers expired. The timers that have expired when the pass
+   starts are moved to the service list and only those are serviced, so an auto-reload timer
+   that has fallen behind catches up by one period on each pass rather than holding up the
+   scheduler. A callback that stops, resets or deletes a timer still on the service list
+   takes it off the list so it is not called. */
+void __TimerService__(void) {
 
 
   Timer_t *cursor = NULL;
 
 
+  if (ISNOTNULLPTR(timerList)) {
+
+
+    __TimerWheelAdvance__();
+
+
+    cursor = timerList->expired[TIMER_EXPIRED_CALLBACK];
+
+
+    while (ISNOTNULLPTR(cursor)) {
+
+
+      __TimerWheelRemove__(cursor);
+
+      __TimerExpiredAppend__(cursor, TIMER_EXPIRED_SERVICE);
+
+      cursor = timerList->expired[TIMER_EXPIRED_CALLBACK];
+    }
+
+
+    cursor = timerList->expired[TIMER_EXPIRED_SERVICE];
+
+
+    while (ISNOTNULLPTR(cursor)) {
+
+
+      __TimerWheelRemove__(cursor);
+
+
+      if (true == cursor->oneShot) {
+
+
+        cursor->state = TimerStateSuspended;
+
+      } else {
+
+
+        /* Start the next period when this one ended so the timer does not drift. */
+        cursor->timerStartTime += cursor->timerPeriod;
+
+        __TimerWheelInsert__(cursor, timerList->wheelNow);
+      }
+
+
+      (*cursor->callback)(cursor, cursor->timerParameter);
+
+      cursor = timerList->expired[TIMER_EXPIRED_SERVICE];
+    }
+  }
+
+
+  return;
+}
+
+
+
+/* The xTimerGetNextExpired() system call will return the next running timer that has
+   expired. Running timers are kept on a timer wheel so the timers that expire on each
+   tick are found without looking at any other timer. Timers are returned in the order
+   they expired and each expiry is returned once. Resetting or restarting the timer
+   places it back on the timer wheel. Timers created by xTimerCreateCallback() are never
+   returned because the scheduler calls their callback instead. */
+Timer_t *xTimerGetNextExpired(void) {
+
+
+  Timer_t *ret = NULL;
+
+
+  /* Check if the timer list has been initialized, if not there are no timers. */
+  if (ISNOTNULLPTR(timerList)) {
+
+
+    __TimerWheelAdvance__();
+
+
+    ret = timerList->expired[TIMER_EXPIRED_POLLED];
+
+
+    if (ISNOTNULLPTR(ret)) {
+
+      __TimerWheelRemove__(ret);
+    }
+  }
+
+
+  return ret;
+}
+
+
+
+/* The __TimerWheelAdvance__() function moves the timer wheel up to the current time. On each tick the slot for that tick holds exactly
+   the timers that expire on it, and when the lowest level wraps the next slot of the level
+   above is spread over the levels below. Ticks with no timer due in the lowest level are
+   skipped a whole turn of the lowest level at a time. */
+static void __TimerWheelAdvance__(void) {
+
+
+  Ticks_t now = zero;
+
+  Ticks_t step = zero;
+
+  Base_t level = zero;
+
+  Base_t timers = zero;
+
+
+  if (ISNOTNULLPTR(timerList)) {
+
+
+    now = __SysGetSysTicks__();
+
+
+    while (timerList->wheelNow != now) {
+
+
+      timers = false;
+
+
+      for (level = zero; level < TIMER_WHEEL_LEVELS; level++) {
+
+
+        if (zero < timerList->wheelCount[level]) {
+
+          timers = true;
+        }
+      }
+
+
+      /* Nothing is on the wheel so it can jump straight to now. */
+      if (false == timers) {
+
+
+        timerList->wheelNow = now;
+
+      } else {
+
+
+        step = 1u;
+
+
+        /* Nothing is due in the lowest level so skip to the end of its turn. */
+        if (zero == timerList->wheelCount[0]) {
+
+          step = TIMER_WHEEL_SLOTS - (timerList->wheelNow & TIMER_WHEEL_MASK);
+        }
+
+
+        if ((now - timerList->wheelNow) < step) {
+
+
+          timerList->wheelNow = now;
+
+        } else {
+
+
+          timerList->wheelNow += step;
+
+
+          /* When the lowest level wraps, find the highest level that wraps with
+             it and spread the next slot of each of those levels downward. */
+          if (zero == (timerList->wheelNow & TIMER_WHEEL_MASK)) {
+
+
+            level = 1u;
+
+
+            while ((level < (TIMER_WHEEL_LEVELS - 1u)) && (zero == ((timerList->wheelNow >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK))) {
+
+              level++;
+            }
+
+
+            while (zero < level) {
+
+
+              __TimerWheelCascade__(level, (Base_t)((timerList->wheelNow >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK));
+
+              level--;
+            }
+          }
+
+
+          /* Everything in the lowest level's slot for this tick has expired. */
+          __TimerWheelCascade__(zero, (Base_t)(timerList->wheelNow & TIMER_WHEEL_MASK));
+        }
+      }
+    }
+  }
+
+
+  return;
+}
+
+
+
+/* The __TimerWheelInsert__() function places a running timer on the timer wheel, or on an
+   expired list if it has already expired. A timer with a period of zero never expires so it
+   is left off the wheel. */
+static void __TimerWheelInsert__(Timer_t *timer_, const Ticks_t now_) {
+
+
+  Ticks_t delta = zero;
+
+  /* Intentionally underflow an unsigned data type
+     to get its maximum value. */
+  Ticks_t maximum = -1;
+
+  Base_t level = zero;
+
+  Timer_t **slot = NULL;
+
+
+  __TimerWheelRemove__(timer_);
+
+
+  if (zero < timer_->timerPeriod) {
+
+
+    /* The timer expires once more than its period has elapsed. */
+    timer_->deadline = timer_->timerStartTime + timer_->timerPeriod + 1u;
+
+    delta = timer_->deadline - timerList->wheelNow;
+
+
+    /* The timer has expired if its deadline is the wheel's current tick, or if more
+       than its period has elapsed by now_ and the deadline is not still ahead of the
+       wheel. The deadline is compared to the wheel rather than the system ticks so
+       that a wheel catching up after a late scheduler pass expires timers in
+       deadline order. Callers on behalf of the end-user pass the system ticks and
+       the wheel passes its own current tick. */
+    if ((zero == delta) || (((now_ - timer_->timerStartTime) > timer_->timerPeriod) && (delta > (maximum >> 1u)))) {
+
+
+      /* Timers with a callback are left for the scheduler to call. */
+      if (ISNOTNULLPTR(timer_->callback)) {
+
+        __TimerExpiredAppend__(timer_, TIMER_EXPIRED_CALLBACK);
+
+      } else {
+
+        __TimerExpiredAppend__(timer_, TIMER_EXPIRED_POLLED);
+      }
+
+    } else {
+
+
+      /* Find the lowest level whose span covers the time until the
+         deadline. */
+      while ((level < (TIMER_WHEEL_LEVELS - 1u)) && (delta >= ((Ticks_t)1u << (TIMER_WHEEL_BITS * (level + 1u))))) {
+
+        level++;
+      }
+
+
+      slot = &timerList->wheel[level][(timer_->deadline >> (TIMER_WHEEL_BITS * level)) & TIMER_WHEEL_MASK];
+
+      timer_->wheelLevel = level;
+
+      timer_->wheelSlot = slot;
+
+      timer_->wheelPrevious = NULL;
+
+      timer_->wheelNext = *slot;
+
+
+      if (ISNOTNULLPTR(*slot)) {
+
+        (*slot)->wheelPrevious = timer_;
+      }
+
+      *slot = timer_;
+
+      timerList->wheelCount[level]++;
+    }
+  }
+
+
+  return;
+}
+
+
+
+/* The __TimerWheelRemove__() function takes a timer off the timer wheel or an expired list. */
+static void __TimerWheelRemove__(Timer_t *timer_) {
+
+
+  if (ISNOTNULLPTR(timer_->wheelSlot)) {
+
+
+    if (ISNOTNULLPTR(timer_->wheelPrevious)) {
+
+      timer_->wheelPrevious->wheelNext = timer_->wheelNext;
+
+    } else {
+
+      *timer_->wheelSlot = timer_->wheelNext;
+    }
+
+
+    if (ISNOTNULLPTR(timer_->wheelNext)) {
+
+      timer_->wheelNext->wheelPrevious = timer_->wheelPrevious;
+
+    } else if (TIMER_WHEEL_LEVELS <= timer_->wheelLevel) {
+
+      timerList->expiredTail[timer_->wheelLevel - TIMER_WHEEL_LEVELS] = timer_->wheelPrevious;
+
+    } else {
+      /* Nothing to do here.. Just for MISRA C:2012 compliance. */
+    }
+
+
+    if (TIMER_WHEEL_LEVELS > timer_->wheelLevel) {
+
+      timerList->wheelCount[timer_->wheelLevel]--;
+    }
+
+
+    timer_->wheelSlot = NULL;
+
+    timer_->wheelNext = NULL;
+
+    timer_->wheelPrevious = NULL;
+  }
+
+
+  return;
+}
+
+
+
+/* The __TimerExpiredAppend__() function appends a timer to the end of an expired list so
+   expiries are returned and called in order. */
+static void __TimerExpiredAppend__(Timer_t *timer_, const Base_t list_) {
+
+
+  timer_->wheelLevel = TIMER_WHEEL_LEVELS + list_;
+
+  timer_->wheelSlot = &timerList->expired[list_];
+
+  timer_->wheelNext = NULL;
+
+  timer_->wheelPrevious = timerList->expiredTail[list_];
+
+
+  if (ISNOTNULLPTR(timerList->expiredTail[list_])) {
+
+    timerList->expiredTail[list_]->wheelNext = timer_;
+
+  } else {
+
+    timerList->expired[list_] = timer_;
+  }
+
+  timerList->expiredTail[list_] = timer_;
+
+
+  return;
+}
+
+
+
+/* The __TimerWheelCascade__() function empties a slot of the timer wheel and places each of
+   its timers again relative to the current time of the wheel. Timers now due go to the
+   expired lists and the rest go to a lower level. */
+static void __TimerWheelCascade__(const Base_t level_, const Base_t slot_) {
+
+
+  Timer_t *cursor = timerList->wheel[level_][slot_];
+
+  Timer_t *next = NULL;
+
+
+  while (ISNOTNULLPTR(cursor)) {
+
+
+    next = cursor->wheelNext;
+
+    __TimerWheelInsert__(cursor, timerList->wheelNow);
+
+    cursor = next;
+  }
+
+
+  return;
+}
+
+
+
+/* __TimerCheck__() is used to validate a timer and returns RETURN_SUCCESS if
+   the timer is valid. Only the timer's kernel memory entry and the magic value
+   stored by xTimerCreate() are checked rather than walking the timer list and
+   the kernel memory region, so every timer system call costs the same no matter
+   how many timers there are. The magic value keeps pointers to other kernel
+   objects, and to deleted timers, from passing as a timer. */
+static Base_t __TimerCheck__(const Timer_t *timer_) {
+
+
+  Base_t ret = RETURN_FAILURE;
+
+
   /* Assert if the timer list is not initialized. */
   SYSASSERT(ISNOTNULLPTR(timerList));
 
@@ -411,30 +922,21 @@ static Base_t __TimerListFindTimer__(const Timer_t *timer_) {
   if ((ISNOTNULLPTR(timerList)) && (ISNOTNULLPTR(timer_))) {
 
 
-    /* Assert if the __MemoryRegionCheckKernel__() fails on the health check or is unable
-       to find the entry for the heap pointer. */
-    SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(timer_, MEMORY_REGION_CHECK_OPTION_W_ADDR));
+    /* Assert if the __MemoryRegionCheckKernel__() is unable to find the
+       entry for the kernel memory pointer. */
+    SYSASSERT(RETURN_SUCCESS == __MemoryRegionCheckKernel__(timer_, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK));
 
 
     /* Check if __MemoryRegionCheckKernel__() was successful. */
-    if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(timer_, MEMORY_REGION_CHECK_OPTION_W_ADDR)) {
-
-      cursor = timerList->head;
+    if (RETURN_SUCCESS == __MemoryRegionCheckKernel__(timer_, MEMORY_REGION_CHECK_OPTION_W_ADDR_QUICK)) {
 
 
-      /* Traverse the timer list while there is a timer
-         and the timer is not the timer we are looking for. */
-      while ((ISNOTNULLPTR(cursor)) && (cursor != timer_)) {
+      /* Assert if the kernel memory does not hold a timer. */
+      SYSASSERT(TIMER_MAGIC == timer_->magic);
 
-        cursor = cursor->next;
-      }
 
-
-      /* Assert if the timer was never found. */
-      SYSASSERT(ISNOTNULLPTR(cursor));
-
-      /* Check if the timer was found. */
-      if (ISNOTNULLPTR(cursor)) {
+      /* Check if the kernel memory holds a timer. */
+      if (TIMER_MAGIC == timer_->magic) {
 
         ret = RETURN_SUCCESS;
       }
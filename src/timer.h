@@ -50,6 +50,9 @@ Base_t xTimerHasTimerExpired(const Timer_t *timer_);
 void xTimerReset(Timer_t *timer_);
 void xTimerStart(Timer_t *timer_);
 void xTimerStop(Timer_t *timer_);
+Timer_t *xTimerGetNextExpired(void);
+Timer_t *xTimerCreateCallback(const Ticks_t timerPeriod_, const Base_t oneShot_, void (*callback_)(Timer_t *timer_, TimerParm_t *parm_), TimerParm_t *timerParameter_);
+void __TimerService__(void);
 
 
 #if defined(POSIX_ARCH_OTHER)
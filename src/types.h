@@ -55,6 +55,17 @@ typedef enum {
 
 
 
+typedef enum {
+  TaskWaitConditionNone,
+  TaskWaitConditionQueueNotEmpty,
+  TaskWaitConditionStreamBytes,
+  TaskWaitConditionTimerExpired,
+  TaskWaitConditionDeviceAvailable
+} TaskWaitCondition_t;
+
+
+
+
 typedef enum {
   TimerStateError,
   TimerStateSuspended,
@@ -76,6 +87,7 @@ typedef enum {
 
 
 typedef VOID_TYPE TaskParm_t;
+typedef VOID_TYPE TimerParm_t;
 typedef UINT8_TYPE Base_t;
 typedef UINT8_TYPE Byte_t;
 typedef VOID_TYPE Addr_t;
@@ -106,8 +118,9 @@ typedef struct Device_s {
 
 typedef struct MemoryEntry_s {
   Byte_t free;
-  Byte_t reserved;
+  Byte_t movable;
   HalfWord_t blocks;
+  HalfWord_t slack;
   struct MemoryEntry_s *next;
 } MemoryEntry_t;
 
@@ -120,6 +133,18 @@ typedef struct MemoryRegion_s {
   HalfWord_t allocations;
   HalfWord_t frees;
   Word_t minAvailableEver;
+  Word_t requestedBytes;
+  Word_t grantedBytes;
+  HalfWord_t freeEntryHistogram[MEMORY_REGION_HISTOGRAM_BUCKETS];
+  Word_t sizeClassAllocations[MEMORY_REGION_HISTOGRAM_BUCKETS];
+  Word_t freeBlocks;
+  HalfWord_t movableEntries;
+  Base_t compactable;
+  Word_t watermarkBytes;
+  Base_t watermarkTripped;
+  Base_t watermarkNotification;
+  void (*watermarkCallback)(const Size_t available_);
+  struct Task_s *watermarkTask;
 } MemoryRegion_t;
 
 
@@ -146,6 +171,11 @@ typedef struct Task_s {
   Ticks_t timerPeriod;
   Ticks_t timerStartTime;
   Ticks_t wdTimerPeriod;
+  TaskWaitCondition_t waitCondition;
+  HalfWord_t waitBytes;
+  Base_t waitReady;
+  struct QueueSet_s *queueSet;
+  Addr_t *waitObject;
   struct Task_s *next;
 } Task_t;
 
@@ -160,6 +190,13 @@ typedef struct TaskRunTimeStats_s {
 
 
 
+typedef struct MemoryHandle_s {
+  Addr_t *addr;
+  HalfWord_t locks;
+} MemoryHandle_t;
+
+
+
 typedef struct MemoryRegionStats_s {
   Word_t largestFreeEntryInBytes;
   Word_t smallestFreeEntryInBytes;
@@ -168,6 +205,11 @@ typedef struct MemoryRegionStats_s {
   Word_t successfulAllocations;
   Word_t successfulFrees;
   Word_t minimumEverFreeBytesRemaining;
+  Word_t externalFragmentationPercent;
+  Word_t requestedBytesInUse;
+  Word_t grantedBytesInUse;
+  Word_t freeEntryHistogram[MEMORY_REGION_HISTOGRAM_BUCKETS];
+  Word_t sizeClassAllocations[MEMORY_REGION_HISTOGRAM_BUCKETS];
 } MemoryRegionStats_t;
 
 
@@ -202,6 +244,16 @@ typedef struct Timer_s {
   TimerState_t state;
   Ticks_t timerPeriod;
   Ticks_t timerStartTime;
+  Ticks_t deadline;
+  Word_t magic;
+  Base_t wheelLevel;
+  struct Timer_s **wheelSlot;
+  struct Timer_s *wheelNext;
+  struct Timer_s *wheelPrevious;
+  Base_t oneShot;
+  TimerParm_t *timerParameter;
+  void (*callback)(struct Timer_s *timer_, TimerParm_t *parm_);
+  struct Task_s *waiter;
   struct Timer_s *next;
 } Timer_t;
 
@@ -211,6 +263,11 @@ typedef struct Timer_s {
 typedef struct TimerList_s {
   Base_t length;
   Timer_t *head;
+  Ticks_t wheelNow;
+  HalfWord_t wheelCount[TIMER_WHEEL_LEVELS];
+  Timer_t *wheel[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+  Timer_t *expired[TIMER_EXPIRED_LISTS];
+  Timer_t *expiredTail[TIMER_EXPIRED_LISTS];
 } TimerList_t;
 
 
@@ -236,24 +293,98 @@ typedef struct QueueMessage_s {
 
 typedef struct Message_s {
   Base_t messageBytes;
-  Char_t messageValue[CONFIG_MESSAGE_VALUE_BYTES];
-  struct Message_s *next;
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+  Ticks_t timestamp;
+#endif
 } Message_t;
 
 
 
 
+typedef struct QueueStats_s {
+  Word_t enqueued;
+  Word_t dequeued;
+  Word_t rejectedFull;
+  Word_t overwritten;
+  Base_t highWater;
+  Ticks_t minimumLatency;
+  Ticks_t maximumLatency;
+  Ticks_t averageLatency;
+  Word_t latencyHistogram[QUEUE_LATENCY_HISTOGRAM_BUCKETS];
+} QueueStats_t;
+
+
+
+
 typedef struct Queue_s {
   Base_t length;
   Base_t limit;
   Base_t locked;
-  Message_t *head;
-  Message_t *tail;
+  Base_t variable;
+  Base_t priority;
+  Base_t overwrite;
+  Base_t messageBytes;
+  Word_t sequence;
+  Size_t size;
+  Size_t head;
+  Size_t tail;
+  Base_t freeSlot;
+  Base_t priorityMap;
+  Base_t priorityHeads[QUEUE_PRIORITY_LEVELS];
+  Base_t priorityTails[QUEUE_PRIORITY_LEVELS];
+  struct QueueSet_s *set;
+  struct Task_s *waiter;
+  struct Topic_s *topic;
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+  QueueStats_t stats;
+  Word_t totalLatency;
+#endif
+  Byte_t *messages;
 } Queue_t;
 
 
 
 
+typedef struct QueueSet_s {
+  Task_t *task;
+  Base_t limit;
+  Base_t ready;
+  Base_t cursor;
+  Queue_t **members;
+} QueueSet_t;
+
+
+
+
+typedef struct Topic_s {
+  Base_t limit;
+  Queue_t **subscribers;
+} Topic_t;
+
+
+
+
+typedef struct TopicMessage_s {
+  HalfWord_t references;
+  Size_t messageBytes;
+  Byte_t *messageValue;
+} TopicMessage_t;
+
+
+
+
+typedef struct SPSCQueue_s {
+  volatile Base_t head;
+  volatile Base_t tail;
+  Base_t slots;
+  Base_t messageBytes;
+  Size_t recordBytes;
+  Byte_t *messages;
+} SPSCQueue_t;
+
+
+
+
 typedef struct SystemInfo_s {
   Char_t productName[OS_PRODUCT_NAME_SIZE];
   Base_t majorVersion;
@@ -265,9 +396,67 @@ typedef struct SystemInfo_s {
 
 
 typedef struct StreamBuffer_s {
-  Byte_t buffer[CONFIG_STREAM_BUFFER_BYTES];
+  Byte_t *buffer;
+  HalfWord_t capacity;
+  HalfWord_t highWater;
+  HalfWord_t head;
+  HalfWord_t tail;
   HalfWord_t length;
+  HalfWord_t triggerLevel;
+  struct Task_s *triggerTask;
+  struct StreamBuffer_s *triggerNext;
+  struct Task_s *waiter;
 } StreamBuffer_t;
 
 
+
+
+typedef struct MessageBuffer_s {
+  StreamBuffer_t *stream;
+  HalfWord_t frames;
+  HalfWord_t frameBytes;
+  HalfWord_t reserveOffset;
+  HalfWord_t reservePad;
+  HalfWord_t reserveBytes;
+  HalfWord_t acquireOffset;
+  HalfWord_t acquireSkip;
+  HalfWord_t acquireBytes;
+  Base_t reserved;
+  Base_t acquired;
+} MessageBuffer_t;
+
+
+
+
+typedef struct Pipe_s {
+  Device_t *device;
+  StreamBuffer_t *stream;
+  Base_t direction;
+  Word_t bytesMoved;
+  struct Pipe_s *next;
+} Pipe_t;
+
+
+
+
+typedef struct BroadcastReader_s {
+  HalfWord_t head;
+  HalfWord_t length;
+  Word_t lost;
+  Base_t active;
+} BroadcastReader_t;
+
+
+
+
+typedef struct BroadcastStream_s {
+  Byte_t *buffer;
+  HalfWord_t capacity;
+  HalfWord_t tail;
+  Base_t policy;
+  Base_t limit;
+  BroadcastReader_t *readers;
+} BroadcastStream_t;
+
+
 #endif
\ No newline at end of file
@@ -42,6 +42,16 @@ void device_harness(void) {
 
   Word_t *data4;
 
+  StreamBuffer_t *stream1;
+
+  Pipe_t *pipe1;
+
+  Task_t *task1;
+
+  Byte_t buffer1[0x20];
+
+  HalfWord_t bytes3;
+
   unit_begin("xDeviceRegisterDevice()");
 
 
@@ -121,9 +131,104 @@ void device_harness(void) {
 
   unit_try(0xFAFAu == *data4);
 
+  xMemFree(data4);
+
   unit_end();
 
 
 
+  unit_begin("xPipeCreate()");
+
+  stream1 = xStreamCreateEx(0x40u);
+
+  unit_try(NULL != stream1);
+
+  bytes1 = 0x10u;
+
+  data1 = (Byte_t *)xMemAlloc(bytes1);
+
+  memcpy(data1, "PIPE INTO STREAM", bytes1);
+
+  unit_try(RETURN_SUCCESS == xDeviceWrite(0xFFu, &bytes1, data1));
+
+  xMemFree(data1);
+
+  pipe1 = xPipeCreate(0xFFu, stream1, PIPE_DEVICE_TO_STREAM);
+
+  unit_try(NULL != pipe1);
+
+  unit_try(NULL == xPipeCreate(0xEEu, stream1, PIPE_DEVICE_TO_STREAM));
+
+  task1 = xTaskCreate((Char_t *)"DEVICE1", device_harness_task, NULL);
+
+  unit_try(NULL != task1);
+
+  xTaskResume(task1);
+
+  xTaskResumeAll();
+
+  xTaskStartScheduler();
+
+  unit_try(0x10u == xStreamBytesAvailable(stream1));
+
+  unit_try(0x10u == xPipeGetBytesMoved(pipe1));
+
+  unit_try(false == xDeviceIsAvailable(0xFFu));
+
+  unit_try(RETURN_SUCCESS == xStreamPeekInto(stream1, buffer1, 0x20u, &bytes3));
+
+  unit_try(0x0u == strncmp("PIPE INTO STREAM", (char *)buffer1, 0x10));
+
+  unit_end();
+
+
+
+  unit_begin("xPipeDelete()");
+
+  xPipeDelete(pipe1);
+
+  unit_try(0x0u == xPipeGetBytesMoved(pipe1));
+
+  pipe1 = xPipeCreate(0xFFu, stream1, PIPE_STREAM_TO_DEVICE);
+
+  unit_try(NULL != pipe1);
+
+  xTaskResumeAll();
+
+  xTaskStartScheduler();
+
+  unit_try(true == xStreamIsEmpty(stream1));
+
+  unit_try(true == xDeviceIsAvailable(0xFFu));
+
+  bytes2 = 0x10u;
+
+  data2 = (Byte_t *)xMemAlloc(bytes2);
+
+  unit_try(RETURN_SUCCESS == xDeviceRead(0xFFu, &bytes2, data2));
+
+  unit_try(0x10u == bytes2);
+
+  unit_try(zero == strncmp((char *)data2, "PIPE INTO STREAM", bytes2));
+
+  xMemFree(data2);
+
+  xStreamDelete(stream1);
+
+  unit_try(0x0u == xPipeGetBytesMoved(pipe1));
+
+  xTaskDelete(task1);
+
+  unit_end();
+
+
+
+  return;
+}
+
+void device_harness_task(Task_t *task_, TaskParm_t *parm_) {
+
+  xTaskSuspendAll();
+
   return;
 }
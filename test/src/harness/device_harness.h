@@ -46,6 +46,7 @@ extern "C" {
 #endif
 
 void device_harness(void);
+void device_harness_task(Task_t* task_, TaskParm_t* parm_);
 
 #ifdef __cplusplus
 }
@@ -29,6 +29,7 @@
 static Size_t sizes[0x20u] = {0x2532u, 0x1832u, 0x132u, 0x2932u, 0x332u, 0x1432u, 0x1332u, 0x532u, 0x1732u, 0x932u, 0x1432u, 0x2232u, 0x1432u, 0x3132u, 0x032u, 0x1132u, 0x632u, 0x932u, 0x1532u, 0x632u, 0x1832u, 0x132u, 0x1332u, 0x3132u, 0x2732u, 0x1532u, 0x2432u, 0x2932u, 0x2432u, 0x2932u, 0x3032u, 0x2332u};
 static Size_t order[0x20u] = {0x02u, 0x16u, 0x07u, 0x0Cu, 0x06u, 0x00u, 0x0Du, 0x18u, 0x10u, 0x08u, 0x0Au, 0x1Eu, 0x0Bu, 0x0Eu, 0x03u, 0x09u, 0x19u, 0x05u, 0x1Cu, 0x1Du, 0x0Fu, 0x01u, 0x1Au, 0x04u, 0x13u, 0x11u, 0x1Fu, 0x12u, 0x17u, 0x15u, 0x14u, 0x1Bu};
 static MemoryTest_t tests[0x20u];
+static Size_t watermarks = zero;
 
 
 void memory_harness(void) {
@@ -40,6 +41,11 @@ void memory_harness(void) {
   MemoryRegionStats_t *mem03;
 
   Task_t *mem04 = NULL;
+  MemoryHandle_t *mem05 = NULL;
+  MemoryHandle_t *mem06 = NULL;
+  Byte_t *mem07 = NULL;
+  Byte_t *mem08 = NULL;
+  Task_t mem09;
 
   unit_begin("Unit test for memory region defragmentation routine");
 
@@ -116,15 +122,15 @@ void memory_harness(void) {
 
   unit_try(NULL != mem02);
 
-  unit_try(0x63A0u == mem02->availableSpaceInBytes);
+  unit_try(0x6300u == mem02->availableSpaceInBytes);
 
-  unit_try(0x63A0u == mem02->largestFreeEntryInBytes);
+  unit_try(0x6300u == mem02->largestFreeEntryInBytes);
 
-  unit_try(0x63A0u == mem02->minimumEverFreeBytesRemaining);
+  unit_try(0x6300u == mem02->minimumEverFreeBytesRemaining);
 
-  unit_try(0x31Du == mem02->numberOfFreeBlocks);
+  unit_try(0x318u == mem02->numberOfFreeBlocks);
 
-  unit_try(0x63A0u == mem02->smallestFreeEntryInBytes);
+  unit_try(0x6300u == mem02->smallestFreeEntryInBytes);
 
   unit_try(0x22u == mem02->successfulAllocations);
 
@@ -134,6 +140,26 @@ void memory_harness(void) {
 
 
 
+  unit_begin("Unit test for memory region fragmentation statistics");
+
+  unit_try(0x0u == mem02->externalFragmentationPercent);
+
+  unit_try(0x320A8u == mem02->requestedBytesInUse);
+
+  unit_try(0x320C0u == mem02->grantedBytesInUse);
+
+  unit_try(0x1u == mem02->freeEntryHistogram[0x9u]);
+
+  unit_try(0xBu == mem02->sizeClassAllocations[0x7u]);
+
+  unit_try(0xCu == mem02->sizeClassAllocations[0x8u]);
+
+  unit_try(0x1u == mem02->sizeClassAllocations[0xCu]);
+
+  unit_end();
+
+
+
   unit_begin("xMemGetKernelStats()");
 
   mem03 = NULL;
@@ -172,6 +198,213 @@ void memory_harness(void) {
 
   unit_end();
 
+
+
+  unit_begin("xMemSetHeapWatermark()");
+
+  watermarks = zero;
+
+  unit_try(RETURN_SUCCESS == xMemSetHeapWatermark(0x10000u, memory_harness_watermark, NULL));
+
+  mem01 = (Base_t *)xMemAlloc(0x20000u);
+
+  unit_try(NULL != mem01);
+
+  unit_try(0x0u == watermarks);
+
+  tests[0].ptr = (void *)xMemAlloc(0x10000u);
+
+  unit_try(NULL != tests[0].ptr);
+
+  unit_try(0x1u == watermarks);
+
+  tests[1].ptr = (void *)xMemAlloc(0x100u);
+
+  unit_try(0x1u == watermarks);
+
+  xMemFree(tests[1].ptr);
+
+  xMemFree(tests[0].ptr);
+
+  tests[0].ptr = (void *)xMemAlloc(0x10000u);
+
+  unit_try(0x2u == watermarks);
+
+  xMemFree(tests[0].ptr);
+
+  xMemFree(mem01);
+
+  unit_try(RETURN_SUCCESS == xMemSetHeapWatermark(zero, NULL, NULL));
+
+  unit_end();
+
+
+
+  unit_begin("xMemSetHeapWatermark() task delete");
+
+  mem04 = xTaskCreate((Char_t *)"NONE", memory_harness_task, NULL);
+
+  unit_try(NULL != mem04);
+
+  unit_try(RETURN_SUCCESS == xMemSetHeapWatermark(0x10000u, NULL, mem04));
+
+  unit_try(RETURN_SUCCESS == xMemSetKernelWatermark(0x100u, NULL, mem04));
+
+  xTaskDelete(mem04);
+
+  mem04 = xTaskCreate((Char_t *)"NONE", memory_harness_task, NULL);
+
+  unit_try(NULL != mem04);
+
+  mem01 = (Base_t *)xMemAlloc(0x30000u);
+
+  unit_try(NULL != mem01);
+
+  unit_try(false == xTaskNotificationIsWaiting(mem04));
+
+  xMemFree(mem01);
+
+  xTaskDelete(mem04);
+
+  memset(&mem09, 0x0, sizeof(Task_t));
+
+  unit_try(RETURN_FAILURE == xMemSetHeapWatermark(0x10000u, NULL, &mem09));
+
+  unit_try(RETURN_FAILURE == xMemSetKernelWatermark(0x100u, NULL, &mem09));
+
+  unit_try(RETURN_SUCCESS == xMemSetHeapWatermark(zero, NULL, NULL));
+
+  unit_try(RETURN_SUCCESS == xMemSetKernelWatermark(zero, NULL, NULL));
+
+  unit_end();
+
+
+
+  unit_begin("xMemHandleAlloc()");
+
+  mem05 = xMemHandleAlloc(0x100u);
+
+  unit_try(NULL != mem05);
+
+  tests[0].ptr = (void *)xMemAlloc(0x100u);
+
+  unit_try(NULL != tests[0].ptr);
+
+  mem06 = xMemHandleAlloc(0x100u);
+
+  unit_try(NULL != mem06);
+
+  unit_end();
+
+
+
+  unit_begin("xMemHandleLock()");
+
+  mem07 = (Byte_t *)xMemHandleLock(mem06);
+
+  unit_try(NULL != mem07);
+
+  memset(mem07, 0xA5, 0x100u);
+
+  xMemFree(tests[0].ptr);
+
+  xMemCompact();
+
+  unit_try(mem07 == (Byte_t *)xMemHandleLock(mem06));
+
+  unit_end();
+
+
+
+  unit_begin("xMemHandleUnlock()");
+
+  xMemHandleUnlock(mem06);
+
+  xMemHandleUnlock(mem06);
+
+  unit_end();
+
+
+
+  unit_begin("xMemCompact()");
+
+  xMemCompact();
+
+  mem08 = (Byte_t *)xMemHandleLock(mem06);
+
+  unit_try(NULL != mem08);
+
+  unit_try(mem08 < mem07);
+
+  unit_try(0xA5u == mem08[0x0u]);
+
+  unit_try(0xA5u == mem08[0xFFu]);
+
+  xMemHandleUnlock(mem06);
+
+  unit_end();
+
+
+
+  unit_begin("xMemHandleFree()");
+
+  xMemHandleFree(mem05);
+
+  xMemHandleFree(mem06);
+
+  unit_try(0x0u == xMemGetUsed());
+
+  unit_end();
+
+
+
+  unit_begin("xMemCompact() reused entry");
+
+  mem07 = (Byte_t *)xMemAlloc(0x140u);
+
+  unit_try(NULL != mem07);
+
+  memset(mem07, 0x1, 0x140u);
+
+  xMemFree(mem07);
+
+  mem07 = (Byte_t *)xMemAlloc(0xAu);
+
+  mem08 = (Byte_t *)xMemAlloc(0xAu);
+
+  mem05 = xMemHandleAlloc(0xAu);
+
+  unit_try((NULL != mem07) && (NULL != mem08) && (NULL != mem05));
+
+  memset(mem08, 0x5A, 0xAu);
+
+  xMemFree(mem07);
+
+  xMemCompact();
+
+  unit_try(0x5Au == mem08[0x0u]);
+
+  unit_try(0x5Au == mem08[0x9u]);
+
+  unit_try(NULL != xMemHandleLock(mem05));
+
+  xMemHandleUnlock(mem05);
+
+  xMemFree(mem08);
+
+  xMemHandleFree(mem05);
+
+  unit_try(0x0u == xMemGetUsed());
+
+  unit_end();
+
+  return;
+}
+
+void memory_harness_watermark(const Size_t available_) {
+
+  watermarks++;
+
   return;
 }
 
@@ -52,6 +52,7 @@ extern "C" {
 
 void memory_harness(void);
 void memory_harness_task(Task_t *task_, TaskParm_t *parm_);
+void memory_harness_watermark(const Size_t available_);
 
 #ifdef __cplusplus
 }
@@ -33,6 +33,40 @@ void queue_harness(void) {
 
   QueueMessage_t *queue02;
 
+  Char_t queue03[CONFIG_MESSAGE_VALUE_BYTES];
+
+  Char_t queue04[0x40];
+
+  QueueMessage_t queue05;
+
+  const Char_t *queue06;
+
+  Base_t queue07;
+
+  QueueMessage_t queue08[0x8];
+
+  SPSCQueue_t *queue09;
+
+  Task_t *queue10;
+
+  QueueSet_t *queue11;
+
+  Queue_t *queue12;
+
+  Word_t queue13;
+
+  QueueStats_t *queue14;
+
+  Topic_t *queue15;
+
+  TopicMessage_t *queue16;
+
+  TopicMessage_t *queue17;
+
+  Task_t queue18;
+
+  Base_t i;
+
   unit_begin("xQueueCreate()");
 
   queue01 = NULL;
@@ -149,27 +183,125 @@ void queue_harness(void) {
 
 
 
-  unit_begin("xQueueLockQueue()");
+  unit_begin("Unit test for queue ring wrap-around");
 
-  queue01 = xQueueCreate(5);
+  queue01 = xQueueCreate(0x5);
 
   unit_try(NULL != queue01);
 
-  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"MESSAGE1"));
+  for (i = 0; i < 0x10u; i++) {
 
-  xQueueLockQueue(queue01);
+    memset(queue03, (int)('A' + i), CONFIG_MESSAGE_VALUE_BYTES);
 
-  unit_try(RETURN_FAILURE == xQueueSend(queue01, 0x8, (Char_t *)"MESSAGE2"));
+    unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, queue03));
+
+    unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, queue03));
+
+    queue02 = xQueueReceive(queue01);
+
+    unit_try(NULL != queue02);
+
+    unit_try(0x0u == memcmp(queue03, queue02->messageValue, CONFIG_MESSAGE_VALUE_BYTES));
+
+    xMemFree(queue02);
+
+    xQueueDropMessage(queue01);
+  }
+
+  unit_try(true == xQueueIsQueueEmpty(queue01));
+
+  for (i = 0; i < 0x5u; i++) {
+
+    memset(queue03, (int)('a' + i), CONFIG_MESSAGE_VALUE_BYTES);
+
+    unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, queue03));
+  }
+
+  unit_try(true == xQueueIsQueueFull(queue01));
+
+  unit_try(RETURN_FAILURE == xQueueSend(queue01, 0x8, queue03));
+
+  for (i = 0; i < 0x5u; i++) {
+
+    queue02 = xQueueReceive(queue01);
+
+    unit_try(NULL != queue02);
+
+    unit_try((Char_t)('a' + i) == queue02->messageValue[0]);
+
+    xMemFree(queue02);
+  }
+
+  unit_try(0x0u == xQueueGetLength(queue01));
+
+  xQueueDelete(queue01);
 
   unit_end();
 
 
 
-  unit_begin("xQueueUnlockQueue()");
+  unit_begin("xQueueCreateEx()");
 
-  xQueueUnLockQueue(queue01);
+  queue01 = xQueueCreateEx(0x5, 0x40);
 
-  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"MESSAGE3"));
+  unit_try(NULL != queue01);
+
+  for (i = 0; i < 0x5u; i++) {
+
+    memset(queue04, (int)('A' + i), 0x40);
+
+    unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x40, queue04));
+  }
+
+  unit_try(RETURN_FAILURE == xQueueSend(queue01, 0x40, queue04));
+
+  unit_try(true == xQueueIsQueueFull(queue01));
+
+  unit_try(NULL == xQueuePeek(queue01));
+
+  unit_end();
+
+
+
+  unit_begin("xQueueReceiveBytes()");
+
+  unit_try(0x0u == xQueueReceiveBytes(queue01, 0x20, queue04));
+
+  unit_try(0x40u == xQueueReceiveBytes(queue01, 0x40, queue04));
+
+  unit_try('A' == queue04[0x0]);
+
+  unit_try('A' == queue04[0x3F]);
+
+  unit_try(0x4u == xQueueGetLength(queue01));
+
+  xQueueDelete(queue01);
+
+  unit_end();
+
+
+
+  unit_begin("xQueuePeekRef()");
+
+  queue01 = xQueueCreate(0x5);
+
+  unit_try(NULL != queue01);
+
+  unit_try(NULL == xQueuePeekRef(queue01, &queue07));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"MESSAGE1"));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x7, (Char_t *)"MESSAGE2"));
+
+  queue07 = zero;
+
+  queue06 = xQueuePeekRef(queue01, &queue07);
+
+  unit_try(NULL != queue06);
+
+  unit_try(0x8u == queue07);
+
+  unit_try(0x0u == strncmp("MESSAGE1", (char *)queue06, 0x8));
 
   unit_try(0x2u == xQueueGetLength(queue01));
 
@@ -177,14 +309,722 @@ void queue_harness(void) {
 
 
 
-  unit_begin("xQueueDelete()");
+  unit_begin("xQueueReceiveInto()");
+
+  unit_try(RETURN_SUCCESS == xQueueReceiveInto(queue01, &queue05));
+
+  unit_try(0x8u == queue05.messageBytes);
+
+  unit_try(0x0u == strncmp("MESSAGE1", (char *)queue05.messageValue, 0x8));
+
+  unit_try(RETURN_SUCCESS == xQueueReceiveInto(queue01, &queue05));
+
+  unit_try(0x7u == queue05.messageBytes);
+
+  unit_try(0x0u == strncmp("MESSAGE", (char *)queue05.messageValue, 0x7));
+
+  unit_try(RETURN_FAILURE == xQueueReceiveInto(queue01, &queue05));
 
   xQueueDelete(queue01);
 
-  unit_try(RETURN_FAILURE == xQueueSend(queue01, 0x8, (Char_t *)"MESSAGE4"));
+  unit_end();
+
+
+
+  unit_begin("xQueueSendBatch()");
+
+  queue01 = xQueueCreate(0x6);
+
+  unit_try(NULL != queue01);
+
+  for (i = 0; i < 0x8u; i++) {
+
+    queue08[i].messageBytes = 0x8;
+
+    memset(queue08[i].messageValue, (int)('A' + i), CONFIG_MESSAGE_VALUE_BYTES);
+  }
+
+  unit_try(0x4u == xQueueSendBatch(queue01, 0x4, queue08, QUEUE_BATCH_ALL_OR_NOTHING));
+
+  unit_try(0x0u == xQueueSendBatch(queue01, 0x4, &queue08[0x4], QUEUE_BATCH_ALL_OR_NOTHING));
+
+  unit_try(0x4u == xQueueGetLength(queue01));
+
+  unit_try(0x2u == xQueueSendBatch(queue01, 0x4, &queue08[0x4], QUEUE_BATCH_BEST_EFFORT));
+
+  unit_try(true == xQueueIsQueueFull(queue01));
+
+  unit_end();
+
+
+
+  unit_begin("xQueueReceiveBatch()");
+
+  memset(queue08, 0x0, sizeof(queue08));
+
+  unit_try(0x5u == xQueueReceiveBatch(queue01, 0x5, queue08));
+
+  unit_try('A' == queue08[0x0].messageValue[0x0]);
+
+  unit_try('E' == queue08[0x4].messageValue[0x0]);
+
+  unit_try(0x1u == xQueueReceiveBatch(queue01, 0x8, queue08));
+
+  unit_try('F' == queue08[0x0].messageValue[0x0]);
+
+  unit_try(0x0u == xQueueReceiveBatch(queue01, 0x8, queue08));
+
+  xQueueDelete(queue01);
+
+  unit_end();
+
+
+
+  unit_begin("xQueueCreateVariable()");
+
+  queue01 = xQueueCreateVariable(0x10, QUEUE_RECORD_BYTES(0x20) + QUEUE_RECORD_BYTES(0x1E));
+
+  unit_try(NULL != queue01);
+
+  memset(queue04, 'A', 0x40);
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x20, queue04));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x1E, queue04));
+
+  unit_try(true == xQueueIsQueueFull(queue01));
+
+  unit_try(RETURN_FAILURE == xQueueSend(queue01, 0x1, queue04));
+
+  unit_try(0x20u == xQueueReceiveBytes(queue01, 0x40, queue04));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x10, queue04));
+
+  unit_try(0x1Eu == xQueueReceiveBytes(queue01, 0x40, queue04));
+
+  unit_try(0x10u == xQueueReceiveBytes(queue01, 0x40, queue04));
+
+  unit_try(true == xQueueIsQueueEmpty(queue01));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x30, queue04));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, queue04));
+
+  unit_try(0x30u == xQueueReceiveBytes(queue01, 0x40, queue04));
+
+  memset(queue04, 'B', 0x40);
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x6, queue04));
+
+  unit_try(0x8u == xQueueReceiveBytes(queue01, 0x40, queue04));
+
+  unit_try('A' == queue04[0x0]);
+
+  queue02 = xQueueReceive(queue01);
+
+  unit_try(NULL != queue02);
+
+  unit_try(0x6u == queue02->messageBytes);
+
+  unit_try('B' == queue02->messageValue[0x0]);
+
+  xMemFree(queue02);
+
+  unit_try(0x0u == xQueueGetLength(queue01));
+
+  xQueueDelete(queue01);
+
+  unit_end();
+
+
+
+  unit_begin("xQueueCreatePriority()");
+
+  queue01 = xQueueCreatePriority(0x6, 0x8);
+
+  unit_try(NULL != queue01);
+
+  unit_end();
+
+
+
+  unit_begin("xQueueSendPriority()");
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"LOW____1"));
+
+  unit_try(RETURN_SUCCESS == xQueueSendPriority(queue01, 0x3, 0x8, (Char_t *)"MEDIUM_1"));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"LOW____2"));
+
+  unit_try(RETURN_SUCCESS == xQueueSendPriority(queue01, 0x7, 0x8, (Char_t *)"HIGH___1"));
+
+  unit_try(RETURN_SUCCESS == xQueueSendPriority(queue01, 0x3, 0x8, (Char_t *)"MEDIUM_2"));
+
+  unit_try(RETURN_SUCCESS == xQueueSendPriority(queue01, 0x7, 0x8, (Char_t *)"HIGH___2"));
+
+  unit_try(RETURN_FAILURE == xQueueSendPriority(queue01, 0x7, 0x8, (Char_t *)"HIGH___3"));
+
+  unit_try(true == xQueueIsQueueFull(queue01));
+
+  unit_try(0x0u == strncmp("HIGH___1", (char *)xQueuePeekRef(queue01, &queue07), 0x8));
+
+  unit_try(RETURN_SUCCESS == xQueueReceiveInto(queue01, &queue05));
+
+  unit_try(0x0u == strncmp("HIGH___1", (char *)queue05.messageValue, 0x8));
+
+  unit_try(RETURN_SUCCESS == xQueueSendPriority(queue01, 0x5, 0x8, (Char_t *)"UPPER__1"));
+
+  unit_try(0x6u == xQueueReceiveBatch(queue01, 0x8, queue08));
+
+  unit_try(0x0u == strncmp("HIGH___2", (char *)queue08[0x0].messageValue, 0x8));
+
+  unit_try(0x0u == strncmp("UPPER__1", (char *)queue08[0x1].messageValue, 0x8));
+
+  unit_try(0x0u == strncmp("MEDIUM_1", (char *)queue08[0x2].messageValue, 0x8));
+
+  unit_try(0x0u == strncmp("MEDIUM_2", (char *)queue08[0x3].messageValue, 0x8));
+
+  unit_try(0x0u == strncmp("LOW____1", (char *)queue08[0x4].messageValue, 0x8));
+
+  unit_try(0x0u == strncmp("LOW____2", (char *)queue08[0x5].messageValue, 0x8));
+
+  unit_try(true == xQueueIsQueueEmpty(queue01));
+
+  unit_try(0x6u == xQueueSendBatch(queue01, 0x6, queue08, QUEUE_BATCH_ALL_OR_NOTHING));
+
+  unit_try(0x0u == xQueueSendBatch(queue01, 0x1, queue08, QUEUE_BATCH_ALL_OR_NOTHING));
+
+  xQueueDelete(queue01);
+
+  unit_end();
+
+
+
+  unit_begin("xQueueCreateMailbox()");
+
+  queue01 = xQueueCreateMailbox(0x1, 0x8);
+
+  unit_try(NULL != queue01);
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"SAMPLE_1"));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"SAMPLE_2"));
+
+  unit_try(0x1u == xQueueGetLength(queue01));
+
+  xQueueDelete(queue01);
+
+  unit_end();
+
+
+
+  unit_begin("xQueueReceiveSequence()");
+
+  queue01 = xQueueCreateMailbox(0x3, 0x8);
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"SAMPLE_1"));
+
+  unit_try(RETURN_SUCCESS == xQueueReceiveSequence(queue01, &queue05, &queue13));
+
+  unit_try(0x1u == queue13);
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"SAMPLE_2"));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"SAMPLE_3"));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"SAMPLE_4"));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"SAMPLE_5"));
+
+  unit_try(true == xQueueIsQueueFull(queue01));
+
+  unit_try(RETURN_SUCCESS == xQueueReceiveSequence(queue01, &queue05, &queue13));
+
+  unit_try(0x3u == queue13);
+
+  unit_try(0x0u == strncmp("SAMPLE_3", (char *)queue05.messageValue, 0x8));
+
+  unit_try(0x2u == xQueueSendBatch(queue01, 0x2, queue08, QUEUE_BATCH_ALL_OR_NOTHING));
+
+  unit_try(RETURN_SUCCESS == xQueueReceiveSequence(queue01, &queue05, &queue13));
+
+  unit_try(0x5u == queue13);
+
+  unit_try(0x0u == strncmp("SAMPLE_5", (char *)queue05.messageValue, 0x8));
+
+  unit_try(RETURN_SUCCESS == xQueueReceiveSequence(queue01, &queue05, &queue13));
+
+  unit_try(0x6u == queue13);
+
+  xQueueDelete(queue01);
 
   unit_end();
 
 
+
+  unit_begin("xQueueGetStats()");
+
+  queue01 = xQueueCreateMailbox(0x2, 0x8);
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"SAMPLE_1"));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"SAMPLE_2"));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"SAMPLE_3"));
+
+  unit_try(RETURN_SUCCESS == xQueueReceiveInto(queue01, &queue05));
+
+  queue14 = xQueueGetStats(queue01);
+
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+
+  unit_try(NULL != queue14);
+
+  unit_try(0x3u == queue14->enqueued);
+
+  unit_try(0x1u == queue14->dequeued);
+
+  unit_try(0x1u == queue14->overwritten);
+
+  unit_try(0x0u == queue14->rejectedFull);
+
+  unit_try(0x2u == queue14->highWater);
+
+  unit_try(queue14->minimumLatency <= queue14->maximumLatency);
+
+  queue13 = zero;
+
+  for (i = zero; i < QUEUE_LATENCY_HISTOGRAM_BUCKETS; i++) {
+
+    queue13 += queue14->latencyHistogram[i];
+  }
+
+  unit_try(0x1u == queue13);
+
+  xMemFree(queue14);
+
+#else
+
+  unit_try(NULL == queue14);
+
+#endif
+
+  xQueueDelete(queue01);
+
+  queue01 = xQueueCreate(0x5);
+
+  unit_try(0x3u == xQueueSendBatch(queue01, 0x3, queue08, QUEUE_BATCH_ALL_OR_NOTHING));
+
+  unit_try(0x0u == xQueueSendBatch(queue01, 0x3, queue08, QUEUE_BATCH_ALL_OR_NOTHING));
+
+  queue14 = xQueueGetStats(queue01);
+
+#if defined(CONFIG_ENABLE_QUEUE_STATS)
+
+  unit_try(NULL != queue14);
+
+  unit_try(0x3u == queue14->enqueued);
+
+  unit_try(0x3u == queue14->highWater);
+
+  xMemFree(queue14);
+
+#else
+
+  unit_try(NULL == queue14);
+
+#endif
+
+  xQueueDelete(queue01);
+
+  unit_end();
+
+
+
+  unit_begin("xQueueSetCreate()");
+
+  queue10 = xTaskCreate((Char_t *)"QUEUE10", queue_harness_task, NULL);
+
+  unit_try(NULL != queue10);
+
+  queue11 = xQueueSetCreate(queue10, 0x2);
+
+  unit_try(NULL != queue11);
+
+  unit_try(NULL == xQueueSetCreate(queue10, 0x2));
+
+  memset(&queue18, 0x0, sizeof(Task_t));
+
+  unit_try(NULL == xQueueSetCreate(&queue18, 0x2));
+
+  unit_end();
+
+
+
+  unit_begin("xQueueSetAdd()");
+
+  queue01 = xQueueCreate(0x5);
+
+  queue12 = xQueueCreatePriority(0x5, 0x8);
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue12, 0x7, (Char_t *)"MESSAGE"));
+
+  unit_try(RETURN_SUCCESS == xQueueSetAdd(queue11, queue01));
+
+  unit_try(RETURN_FAILURE == xQueueSetAdd(queue11, queue01));
+
+  unit_try(RETURN_SUCCESS == xQueueSetAdd(queue11, queue12));
+
+  unit_end();
+
+
+
+  unit_begin("xQueueSetSelect()");
+
+  unit_try(queue12 == xQueueSetSelect(queue11));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x7, (Char_t *)"MESSAGE"));
+
+  unit_try(queue01 == xQueueSetSelect(queue11));
+
+  unit_try(queue12 == xQueueSetSelect(queue11));
+
+  xQueueDropMessage(queue12);
+
+  unit_try(queue01 == xQueueSetSelect(queue11));
+
+  xQueueDropMessage(queue01);
+
+  unit_try(NULL == xQueueSetSelect(queue11));
+
+  unit_try(0x1u == xQueueSendBatch(queue01, 0x1, queue08, QUEUE_BATCH_ALL_OR_NOTHING));
+
+  unit_try(queue01 == xQueueSetSelect(queue11));
+
+  xQueueDropMessage(queue01);
+
+  unit_end();
+
+
+
+  unit_begin("xQueueSetRemove()");
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue12, 0x7, (Char_t *)"MESSAGE"));
+
+  unit_try(RETURN_SUCCESS == xQueueSetRemove(queue11, queue12));
+
+  unit_try(RETURN_FAILURE == xQueueSetRemove(queue11, queue12));
+
+  unit_try(NULL == xQueueSetSelect(queue11));
+
+  xQueueDelete(queue12);
+
+  unit_end();
+
+
+
+  unit_begin("xQueueSetDelete()");
+
+  xQueueSetDelete(queue11);
+
+  unit_try(NULL == queue10->queueSet);
+
+  xQueueDelete(queue01);
+
+  xTaskDelete(queue10);
+
+  unit_end();
+
+
+
+  unit_begin("xSPSCQueueCreate()");
+
+  queue09 = xSPSCQueueCreate(0x5, 0x8);
+
+  unit_try(NULL != queue09);
+
+  unit_try(0x0u == xSPSCQueueGetLength(queue09));
+
+  unit_end();
+
+
+
+  unit_begin("xSPSCQueueSend()");
+
+  for (i = 0; i < 0x5u; i++) {
+
+    memset(queue03, (int)('A' + i), CONFIG_MESSAGE_VALUE_BYTES);
+
+    unit_try(RETURN_SUCCESS == xSPSCQueueSend(queue09, 0x8, queue03));
+  }
+
+  unit_try(RETURN_FAILURE == xSPSCQueueSend(queue09, 0x8, queue03));
+
+  unit_try(0x5u == xSPSCQueueGetLength(queue09));
+
+  unit_end();
+
+
+
+  unit_begin("xSPSCQueueReceive()");
+
+  for (i = 0; i < 0x3u; i++) {
+
+    unit_try(RETURN_SUCCESS == xSPSCQueueReceive(queue09, &queue05));
+
+    unit_try((Char_t)('A' + i) == queue05.messageValue[0x0]);
+  }
+
+  unit_try(RETURN_SUCCESS == xSPSCQueueSend(queue09, 0x4, (Char_t *)"WRAP"));
+
+  unit_try(0x3u == xSPSCQueueGetLength(queue09));
+
+  unit_try(RETURN_SUCCESS == xSPSCQueueReceive(queue09, &queue05));
+
+  unit_try(RETURN_SUCCESS == xSPSCQueueReceive(queue09, &queue05));
+
+  unit_try(RETURN_SUCCESS == xSPSCQueueReceive(queue09, &queue05));
+
+  unit_try(0x4u == queue05.messageBytes);
+
+  unit_try(0x0u == strncmp("WRAP", (char *)queue05.messageValue, 0x4));
+
+  unit_try(RETURN_FAILURE == xSPSCQueueReceive(queue09, &queue05));
+
+  unit_end();
+
+
+
+  unit_begin("xSPSCQueueDelete()");
+
+  xSPSCQueueDelete(queue09);
+
+  unit_end();
+
+
+
+  unit_begin("xTopicCreate()");
+
+  queue15 = xTopicCreate(0x2);
+
+  unit_try(NULL != queue15);
+
+  unit_end();
+
+
+
+  unit_begin("xTopicSubscribe()");
+
+  queue01 = xQueueCreate(0x5);
+
+  queue12 = xQueueCreate(0x5);
+
+  unit_try(RETURN_SUCCESS == xTopicSubscribe(queue15, queue01));
+
+  unit_try(RETURN_FAILURE == xTopicSubscribe(queue15, queue01));
+
+  unit_try(RETURN_SUCCESS == xTopicSubscribe(queue15, queue12));
+
+  unit_end();
+
+
+
+  unit_begin("xTopicPublish()");
+
+  unit_try(0x2u == xTopicPublish(queue15, 0xA, (Byte_t *)"TOPIC_MSG1"));
+
+  unit_try(0x1u == xQueueGetLength(queue01));
+
+  unit_try(0x1u == xQueueGetLength(queue12));
+
+  unit_end();
+
+
+
+  unit_begin("xTopicReceive()");
+
+  queue16 = xTopicReceive(queue01);
+
+  queue17 = xTopicReceive(queue12);
+
+  unit_try(NULL != queue16);
+
+  unit_try(queue16 == queue17);
+
+  unit_try(0x2u == queue16->references);
+
+  unit_try(0xAu == queue16->messageBytes);
+
+  unit_try(0x0u == strncmp("TOPIC_MSG1", (char *)queue16->messageValue, 0xA));
+
+  unit_try(NULL == xTopicReceive(queue01));
+
+  unit_end();
+
+
+
+  unit_begin("xTopicRelease()");
+
+  xTopicRelease(queue16);
+
+  unit_try(0x1u == queue17->references);
+
+  xTopicRelease(queue17);
+
+  unit_end();
+
+
+
+  unit_begin("xTopicUnsubscribe()");
+
+  xQueueLockQueue(queue12);
+
+  unit_try(0x1u == xTopicPublish(queue15, 0xA, (Byte_t *)"TOPIC_MSG2"));
+
+  xQueueUnLockQueue(queue12);
+
+  unit_try(RETURN_SUCCESS == xTopicUnsubscribe(queue15, queue01));
+
+  unit_try(0x0u == xQueueGetLength(queue01));
+
+  unit_try(RETURN_FAILURE == xTopicUnsubscribe(queue15, queue01));
+
+  unit_try(0x1u == xTopicPublish(queue15, 0xA, (Byte_t *)"TOPIC_MSG3"));
+
+  unit_try(0x0u == xQueueGetLength(queue01));
+
+  unit_try(0x1u == xQueueGetLength(queue12));
+
+  unit_end();
+
+
+
+  unit_begin("xTopicSubscribe() plain queue calls");
+
+  unit_try(RETURN_FAILURE == xQueueSend(queue12, 0x8, (Char_t *)"MESSAGE1"));
+
+  unit_try(0x0u == xQueueSendBatch(queue12, 0x1, queue08, QUEUE_BATCH_BEST_EFFORT));
+
+  unit_try(NULL == xQueueReceive(queue12));
+
+  unit_try(RETURN_FAILURE == xQueueReceiveInto(queue12, &queue05));
+
+  unit_try(0x0u == xQueueReceiveBatch(queue12, 0x1, queue08));
+
+  xQueueDropMessage(queue12);
+
+  unit_try(0x1u == xQueueGetLength(queue12));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"MESSAGE1"));
+
+  unit_try(RETURN_FAILURE == xTopicSubscribe(queue15, queue01));
+
+  xQueueDropMessage(queue01);
+
+  unit_end();
+
+
+
+  unit_begin("xTopicDelete()");
+
+  xTopicDelete(queue15);
+
+  unit_try(0x0u == xQueueGetLength(queue12));
+
+  unit_try(RETURN_FAILURE == xTopicSubscribe(queue15, queue12));
+
+  xQueueDelete(queue12);
+
+  xQueueDelete(queue01);
+
+  unit_end();
+
+
+
+  unit_begin("xTopicSubscribe() mailbox");
+
+  queue15 = xTopicCreate(0x1);
+
+  queue12 = xQueueCreateMailbox(0x1, sizeof(TopicMessage_t *));
+
+  unit_try(RETURN_SUCCESS == xTopicSubscribe(queue15, queue12));
+
+  for (i = 0; i < 0xA; i++) {
+
+    memset(queue04, (int)('A' + i), 0x40);
+
+    unit_try(0x1u == xTopicPublish(queue15, 0x40, (Byte_t *)queue04));
+  }
+
+  unit_try(0x1u == xQueueGetLength(queue12));
+
+  queue16 = xTopicReceive(queue12);
+
+  unit_try(NULL != queue16);
+
+  unit_try('J' == queue16->messageValue[0]);
+
+  xTopicRelease(queue16);
+
+  unit_try(0x0u == xMemGetUsed());
+
+  xTopicDelete(queue15);
+
+  xQueueDelete(queue12);
+
+  unit_end();
+
+
+
+  unit_begin("xQueueLockQueue()");
+
+  queue01 = xQueueCreate(5);
+
+  unit_try(NULL != queue01);
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"MESSAGE1"));
+
+  xQueueLockQueue(queue01);
+
+  unit_try(RETURN_FAILURE == xQueueSend(queue01, 0x8, (Char_t *)"MESSAGE2"));
+
+  unit_end();
+
+
+
+  unit_begin("xQueueUnlockQueue()");
+
+  xQueueUnLockQueue(queue01);
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"MESSAGE3"));
+
+  unit_try(0x2u == xQueueGetLength(queue01));
+
+  unit_end();
+
+
+
+  unit_begin("xQueueDelete()");
+
+  xQueueDelete(queue01);
+
+  unit_try(RETURN_FAILURE == xQueueSend(queue01, 0x8, (Char_t *)"MESSAGE4"));
+
+  queue02 = (QueueMessage_t *)xMemAlloc(sizeof(QueueMessage_t));
+
+  unit_try(NULL != queue02);
+
+  unit_try(RETURN_FAILURE == xQueueSend((Queue_t *)queue02, 0x8, (Char_t *)"MESSAGE5"));
+
+  xMemFree(queue02);
+
+  unit_end();
+
+
+  return;
+}
+
+void queue_harness_task(Task_t *task_, TaskParm_t *parm_) {
+
   return;
 }
@@ -45,6 +45,7 @@ extern "C" {
 #endif
 
 void queue_harness(void);
+void queue_harness_task(Task_t* task_, TaskParm_t* parm_);
 
 #ifdef __cplusplus
 }
@@ -36,6 +36,24 @@ void stream_harness(void) {
 
   Byte_t *stream03 = NULL;
 
+  Byte_t stream04[0x10];
+
+  StreamBuffer_t *stream05 = NULL;
+
+  MessageBuffer_t *stream06 = NULL;
+
+  Task_t *stream08 = NULL;
+
+  TaskNotification_t *stream09 = NULL;
+
+  BroadcastStream_t *stream10 = NULL;
+
+  Base_t stream11 = zero;
+
+  Base_t stream12 = zero;
+
+  Byte_t *stream07 = NULL;
+
 
 
   unit_begin("xStreamCreate()");
@@ -100,6 +118,117 @@ void stream_harness(void) {
 
 
 
+  unit_begin("Unit test for stream wraparound");
+
+  for (i = 0; i < 0x10u; i++) {
+
+    unit_try(RETURN_SUCCESS == xStreamSend(stream01, i));
+  }
+
+  xMemFree(stream03);
+
+  stream03 = xStreamReceive(stream01, &stream02);
+
+  unit_try(NULL != stream03);
+
+  unit_try(0x10u == stream02);
+
+  for (i = 0; i < CONFIG_STREAM_BUFFER_BYTES; i++) {
+
+    unit_try(RETURN_SUCCESS == xStreamSend(stream01, i));
+  }
+
+  unit_try(RETURN_FAILURE == xStreamSend(stream01, zero));
+
+  xMemFree(stream03);
+
+  stream03 = xStreamReceive(stream01, &stream02);
+
+  unit_try(NULL != stream03);
+
+  unit_try(0x20u == stream02);
+
+  for (i = 0; i < CONFIG_STREAM_BUFFER_BYTES; i++) {
+
+    unit_try(i == stream03[i]);
+  }
+
+  xMemFree(stream03);
+
+  unit_try(true == xStreamIsEmpty(stream01));
+
+  unit_end();
+
+
+
+  unit_begin("xStreamSendBytes()");
+
+  unit_try(0x10u == xStreamSendBytes(stream01, (Byte_t *)"0123456789ABCDEF", 0x10u, STREAM_SEND_ALL_OR_NOTHING));
+
+  unit_try(0x0u == xStreamSendBytes(stream01, (Byte_t *)"0123456789ABCDEF0123", 0x14u, STREAM_SEND_ALL_OR_NOTHING));
+
+  unit_try(0x10u == xStreamBytesAvailable(stream01));
+
+  unit_try(0x10u == xStreamSendBytes(stream01, (Byte_t *)"0123456789ABCDEF0123", 0x14u, STREAM_SEND_PARTIAL));
+
+  unit_try(true == xStreamIsFull(stream01));
+
+  unit_try(0x0u == xStreamSendBytes(stream01, (Byte_t *)"0", 0x1u, STREAM_SEND_PARTIAL));
+
+  stream03 = xStreamReceive(stream01, &stream02);
+
+  unit_try(NULL != stream03);
+
+  unit_try(0x20u == stream02);
+
+  unit_try(0x0u == strncmp("0123456789ABCDEF0123456789ABCDEF", (char *)stream03, 0x20));
+
+  xMemFree(stream03);
+
+  unit_end();
+
+
+
+  unit_begin("xStreamPeekInto()");
+
+  unit_try(RETURN_FAILURE == xStreamPeekInto(stream01, stream04, 0x10u, &stream02));
+
+  unit_try(0x14u == xStreamSendBytes(stream01, (Byte_t *)"ABCDEFGHIJKLMNOPQRST", 0x14u, STREAM_SEND_ALL_OR_NOTHING));
+
+  unit_try(RETURN_SUCCESS == xStreamPeekInto(stream01, stream04, 0x4u, &stream02));
+
+  unit_try(0x4u == stream02);
+
+  unit_try(0x0u == strncmp("ABCD", (char *)stream04, 0x4));
+
+  unit_try(0x14u == xStreamBytesAvailable(stream01));
+
+  unit_end();
+
+
+
+  unit_begin("xStreamReceiveInto()");
+
+  unit_try(RETURN_SUCCESS == xStreamReceiveInto(stream01, stream04, 0x10u, &stream02));
+
+  unit_try(0x10u == stream02);
+
+  unit_try(0x0u == strncmp("ABCDEFGHIJKLMNOP", (char *)stream04, 0x10));
+
+  unit_try(0x4u == xStreamBytesAvailable(stream01));
+
+  unit_try(RETURN_SUCCESS == xStreamReceiveInto(stream01, stream04, 0x10u, &stream02));
+
+  unit_try(0x4u == stream02);
+
+  unit_try(0x0u == strncmp("QRST", (char *)stream04, 0x4));
+
+  unit_try(RETURN_FAILURE == xStreamReceiveInto(stream01, stream04, 0x10u, &stream02));
+
+  unit_end();
+
+
+
   unit_begin("xStreamReset()");
 
   for (i = 0; i < CONFIG_STREAM_BUFFER_BYTES; i++) {
@@ -119,6 +248,392 @@ void stream_harness(void) {
 
 
 
+  unit_begin("xStreamGetHighWater()");
+
+  unit_try(CONFIG_STREAM_BUFFER_BYTES == xStreamGetHighWater(stream01));
+
+  unit_end();
+
+
+
+  unit_begin("xStreamCreateEx()");
+
+  stream05 = xStreamCreateEx(0x4u);
+
+  unit_try(NULL != stream05);
+
+  unit_try(0x3u == xStreamSendBytes(stream05, (Byte_t *)"ABC", 0x3u, STREAM_SEND_ALL_OR_NOTHING));
+
+  unit_try(RETURN_SUCCESS == xStreamReceiveInto(stream05, stream04, 0x2u, &stream02));
+
+  unit_try(0x3u == xStreamSendBytes(stream05, (Byte_t *)"DEFG", 0x4u, STREAM_SEND_PARTIAL));
+
+  unit_try(true == xStreamIsFull(stream05));
+
+  unit_try(RETURN_FAILURE == xStreamSend(stream05, zero));
+
+  unit_try(RETURN_SUCCESS == xStreamReceiveInto(stream05, stream04, 0x10u, &stream02));
+
+  unit_try(0x4u == stream02);
+
+  unit_try(0x0u == strncmp("CDEF", (char *)stream04, 0x4));
+
+  unit_try(0x4u == xStreamGetHighWater(stream05));
+
+  unit_try(NULL == xStreamCreateEx(zero));
+
+  xStreamDelete(stream05);
+
+  unit_end();
+
+
+
+  unit_begin("xStreamSetTriggerLevel()");
+
+  stream08 = xTaskCreate((Char_t *)"STREAM08", stream_harness_task, NULL);
+
+  unit_try(NULL != stream08);
+
+  stream05 = xStreamCreateEx(0x8u);
+
+  unit_try(RETURN_FAILURE == xStreamSetTriggerLevel(stream05, 0x9u, stream08));
+
+  unit_try(RETURN_SUCCESS == xStreamSetTriggerLevel(stream05, 0x4u, stream08));
+
+  unit_try(0x3u == xStreamSendBytes(stream05, (Byte_t *)"ABC", 0x3u, STREAM_SEND_ALL_OR_NOTHING));
+
+  unit_try(false == xTaskNotificationIsWaiting(stream08));
+
+  unit_try(RETURN_SUCCESS == xStreamSend(stream05, 0x44u));
+
+  unit_try(true == xTaskNotificationIsWaiting(stream08));
+
+  stream09 = xTaskNotifyTake(stream08);
+
+  unit_try(NULL != stream09);
+
+  unit_try(STREAM_TRIGGER_NOTIFICATION == (Byte_t)stream09->notificationValue[0]);
+
+  xMemFree(stream09);
+
+  unit_try(RETURN_SUCCESS == xStreamSend(stream05, 0x45u));
+
+  unit_try(false == xTaskNotificationIsWaiting(stream08));
+
+  unit_try(RETURN_SUCCESS == xStreamReceiveInto(stream05, stream04, 0x4u, &stream02));
+
+  unit_try(0x3u == xStreamSendBytes(stream05, (Byte_t *)"FGH", 0x3u, STREAM_SEND_ALL_OR_NOTHING));
+
+  unit_try(true == xTaskNotificationIsWaiting(stream08));
+
+  xTaskNotifyStateClear(stream08);
+
+  unit_try(RETURN_SUCCESS == xStreamSetTriggerLevel(stream05, zero, NULL));
+
+  xStreamReset(stream05);
+
+  unit_try(0x4u == xStreamSendBytes(stream05, (Byte_t *)"IJKL", 0x4u, STREAM_SEND_ALL_OR_NOTHING));
+
+  unit_try(false == xTaskNotificationIsWaiting(stream08));
+
+  xStreamDelete(stream05);
+
+  xTaskDelete(stream08);
+
+  unit_end();
+
+
+
+  unit_begin("xStreamSetTriggerLevel() task delete");
+
+  stream08 = xTaskCreate((Char_t *)"STREAM08", stream_harness_task, NULL);
+
+  stream05 = xStreamCreateEx(0x8u);
+
+  unit_try(RETURN_SUCCESS == xStreamSetTriggerLevel(stream05, 0x4u, stream08));
+
+  xTaskDelete(stream08);
+
+  stream08 = xTaskCreate((Char_t *)"STREAM08", stream_harness_task, NULL);
+
+  unit_try(NULL != stream08);
+
+  unit_try(0x4u == xStreamSendBytes(stream05, (Byte_t *)"ABCD", 0x4u, STREAM_SEND_ALL_OR_NOTHING));
+
+  unit_try(false == xTaskNotificationIsWaiting(stream08));
+
+  xStreamDelete(stream05);
+
+  xTaskDelete(stream08);
+
+  unit_end();
+
+
+
+  unit_begin("xMessageBufferCreate()");
+
+  stream06 = xMessageBufferCreate(0x10u);
+
+  unit_try(NULL != stream06);
+
+  unit_try(NULL == xMessageBufferCreate(MESSAGE_BUFFER_HEADER_BYTES));
+
+  unit_end();
+
+
+
+  unit_begin("xMessageBufferSend()");
+
+  unit_try(RETURN_SUCCESS == xMessageBufferSend(stream06, 0x5u, (Byte_t *)"HELLO"));
+
+  unit_try(RETURN_SUCCESS == xMessageBufferSend(stream06, 0x6u, (Byte_t *)"WORLD!"));
+
+  unit_try(RETURN_FAILURE == xMessageBufferSend(stream06, 0x1u, (Byte_t *)"X"));
+
+  unit_try(0x2u == xMessageBufferGetFrames(stream06));
+
+  unit_try(0xBu == xMessageBufferGetBytes(stream06));
+
+  unit_end();
+
+
+
+  unit_begin("xMessageBufferReceive()");
+
+  unit_try(RETURN_FAILURE == xMessageBufferReceive(stream06, stream04, 0x4u, &stream02));
+
+  unit_try(0x2u == xMessageBufferGetFrames(stream06));
+
+  unit_try(RETURN_SUCCESS == xMessageBufferReceive(stream06, stream04, 0x10u, &stream02));
+
+  unit_try(0x5u == stream02);
+
+  unit_try(0x0u == strncmp("HELLO", (char *)stream04, 0x5));
+
+  unit_end();
+
+
+
+  unit_begin("xMessageBufferReserve()");
+
+  stream07 = xMessageBufferReserve(stream06, 0x4u);
+
+  unit_try(NULL != stream07);
+
+  unit_try(NULL == xMessageBufferReserve(stream06, 0x1u));
+
+  memcpy(stream07, "ABCD", 0x4);
+
+  unit_try(0x1u == xMessageBufferGetFrames(stream06));
+
+  unit_end();
+
+
+
+  unit_begin("xMessageBufferCommit()");
+
+  unit_try(RETURN_FAILURE == xMessageBufferCommit(stream06, 0x5u));
+
+  unit_try(RETURN_SUCCESS == xMessageBufferCommit(stream06, 0x3u));
+
+  unit_try(RETURN_FAILURE == xMessageBufferCommit(stream06, 0x3u));
+
+  unit_try(0x2u == xMessageBufferGetFrames(stream06));
+
+  unit_try(0x9u == xMessageBufferGetBytes(stream06));
+
+  unit_end();
+
+
+
+  unit_begin("xMessageBufferAcquire()");
+
+  stream07 = xMessageBufferAcquire(stream06, &stream02);
+
+  unit_try(NULL != stream07);
+
+  unit_try(0x6u == stream02);
+
+  unit_try(0x0u == strncmp("WORLD!", (char *)stream07, 0x6));
+
+  unit_try(NULL == xMessageBufferAcquire(stream06, &stream02));
+
+  unit_end();
+
+
+
+  unit_begin("xMessageBufferRelease()");
+
+  unit_try(RETURN_SUCCESS == xMessageBufferRelease(stream06));
+
+  unit_try(RETURN_FAILURE == xMessageBufferRelease(stream06));
+
+  stream07 = xMessageBufferAcquire(stream06, &stream02);
+
+  unit_try(0x3u == stream02);
+
+  unit_try(0x0u == strncmp("ABC", (char *)stream07, 0x3));
+
+  unit_try(RETURN_SUCCESS == xMessageBufferRelease(stream06));
+
+  unit_try(0x0u == xMessageBufferGetFrames(stream06));
+
+  unit_try(0x0u == xMessageBufferGetBytes(stream06));
+
+  unit_end();
+
+
+
+  unit_begin("Unit test for message buffer wraparound");
+
+  unit_try(RETURN_SUCCESS == xMessageBufferSend(stream06, 0x6u, (Byte_t *)"FRAME1"));
+
+  unit_try(RETURN_SUCCESS == xMessageBufferSend(stream06, 0x2u, (Byte_t *)"F2"));
+
+  unit_try(RETURN_SUCCESS == xMessageBufferReceive(stream06, stream04, 0x10u, &stream02));
+
+  unit_try(RETURN_SUCCESS == xMessageBufferSend(stream06, 0x4u, (Byte_t *)"FRM3"));
+
+  unit_try(RETURN_SUCCESS == xMessageBufferReceive(stream06, stream04, 0x10u, &stream02));
+
+  unit_try(0x2u == stream02);
+
+  unit_try(0x0u == strncmp("F2", (char *)stream04, 0x2));
+
+  unit_try(RETURN_SUCCESS == xMessageBufferReceive(stream06, stream04, 0x10u, &stream02));
+
+  unit_try(0x4u == stream02);
+
+  unit_try(0x0u == strncmp("FRM3", (char *)stream04, 0x4));
+
+  unit_try(RETURN_FAILURE == xMessageBufferReceive(stream06, stream04, 0x10u, &stream02));
+
+  unit_end();
+
+
+
+  unit_begin("xMessageBufferDelete()");
+
+  xMessageBufferDelete(stream06);
+
+  unit_try(RETURN_FAILURE == xMessageBufferSend(stream06, 0x1u, (Byte_t *)"X"));
+
+  unit_end();
+
+
+
+  unit_begin("xBroadcastStreamCreate()");
+
+  stream10 = xBroadcastStreamCreate(0x8u, 0x2u, BROADCAST_STREAM_BACKPRESSURE);
+
+  unit_try(NULL != stream10);
+
+  unit_end();
+
+
+
+  unit_begin("xBroadcastStreamAddReader()");
+
+  unit_try(RETURN_SUCCESS == xBroadcastStreamAddReader(stream10, &stream11));
+
+  unit_try(RETURN_SUCCESS == xBroadcastStreamAddReader(stream10, &stream12));
+
+  unit_try(stream11 != stream12);
+
+  unit_try(0x1u == stream12);
+
+  unit_try(RETURN_FAILURE == xBroadcastStreamAddReader(stream10, &stream12));
+
+  unit_end();
+
+
+
+  unit_begin("xBroadcastStreamSend()");
+
+  unit_try(0x6u == xBroadcastStreamSend(stream10, (Byte_t *)"ABCDEF", 0x6u));
+
+  unit_try(0x6u == xBroadcastStreamBytesAvailable(stream10, stream11));
+
+  unit_try(0x6u == xBroadcastStreamBytesAvailable(stream10, stream12));
+
+  unit_end();
+
+
+
+  unit_begin("xBroadcastStreamReceive()");
+
+  unit_try(RETURN_SUCCESS == xBroadcastStreamReceive(stream10, stream11, stream04, 0x10u, &stream02));
+
+  unit_try(0x6u == stream02);
+
+  unit_try(0x0u == strncmp("ABCDEF", (char *)stream04, 0x6));
+
+  unit_try(0x0u == xBroadcastStreamBytesAvailable(stream10, stream11));
+
+  unit_try(0x2u == xBroadcastStreamSend(stream10, (Byte_t *)"GHIJ", 0x4u));
+
+  unit_try(RETURN_SUCCESS == xBroadcastStreamReceive(stream10, stream12, stream04, 0x10u, &stream02));
+
+  unit_try(0x8u == stream02);
+
+  unit_try(0x0u == strncmp("ABCDEFGH", (char *)stream04, 0x8));
+
+  unit_try(RETURN_SUCCESS == xBroadcastStreamReceive(stream10, stream11, stream04, 0x10u, &stream02));
+
+  unit_try(0x2u == stream02);
+
+  unit_try(0x0u == strncmp("GH", (char *)stream04, 0x2));
+
+  unit_try(RETURN_FAILURE == xBroadcastStreamReceive(stream10, stream11, stream04, 0x10u, &stream02));
+
+  unit_end();
+
+
+
+  unit_begin("xBroadcastStreamRemoveReader()");
+
+  unit_try(0x8u == xBroadcastStreamSend(stream10, (Byte_t *)"12345678", 0x8u));
+
+  unit_try(0x0u == xBroadcastStreamSend(stream10, (Byte_t *)"9", 0x1u));
+
+  unit_try(RETURN_SUCCESS == xBroadcastStreamRemoveReader(stream10, stream12));
+
+  unit_try(RETURN_FAILURE == xBroadcastStreamRemoveReader(stream10, stream12));
+
+  unit_try(RETURN_SUCCESS == xBroadcastStreamReceive(stream10, stream11, stream04, 0x4u, &stream02));
+
+  unit_try(0x4u == xBroadcastStreamSend(stream10, (Byte_t *)"9ABC", 0x4u));
+
+  xBroadcastStreamDelete(stream10);
+
+  unit_end();
+
+
+
+  unit_begin("xBroadcastStreamGetLost()");
+
+  stream10 = xBroadcastStreamCreate(0x4u, 0x1u, BROADCAST_STREAM_OVERWRITE);
+
+  unit_try(RETURN_SUCCESS == xBroadcastStreamAddReader(stream10, &stream11));
+
+  unit_try(0x3u == xBroadcastStreamSend(stream10, (Byte_t *)"ABC", 0x3u));
+
+  unit_try(0x3u == xBroadcastStreamSend(stream10, (Byte_t *)"DEF", 0x3u));
+
+  unit_try(0x2u == xBroadcastStreamGetLost(stream10, stream11));
+
+  unit_try(RETURN_SUCCESS == xBroadcastStreamReceive(stream10, stream11, stream04, 0x10u, &stream02));
+
+  unit_try(0x4u == stream02);
+
+  unit_try(0x0u == strncmp("CDEF", (char *)stream04, 0x4));
+
+  xBroadcastStreamDelete(stream10);
+
+  unit_end();
+
+
+
   unit_begin("xStreamDelete()");
 
   xStreamReset(stream01);
@@ -131,5 +646,10 @@ void stream_harness(void) {
 
 
 
+  return;
+}
+
+void stream_harness_task(Task_t *task_, TaskParm_t *parm_) {
+
   return;
 }
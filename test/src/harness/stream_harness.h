@@ -45,6 +45,7 @@ extern "C" {
 #endif
 
 void stream_harness(void);
+void stream_harness_task(Task_t* task_, TaskParm_t* parm_);
 
 #ifdef __cplusplus
 }
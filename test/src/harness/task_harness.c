@@ -43,6 +43,12 @@ void task_harness(void) {
   Task_t *task10 = NULL;
   Task_t *task11 = NULL;
   Task_t *task12 = NULL;
+  Task_t *task13 = NULL;
+  QueueSet_t *task14 = NULL;
+  Queue_t *task15 = NULL;
+  Task_t *task16 = NULL;
+  StreamBuffer_t *task17 = NULL;
+  Timer_t *task18 = NULL;
 
 
   unit_begin("xTaskCreate()");
@@ -375,6 +381,126 @@ void task_harness(void) {
 
 
 
+  unit_begin("Unit test for queue set event");
+
+  xTaskResumeAll();
+
+  task15 = xQueueCreate(0x5);
+
+  unit_try(NULL != task15);
+
+  task13 = xTaskCreate((Char_t *)"TASK13", task_harness_task3, NULL);
+
+  unit_try(NULL != task13);
+
+  task14 = xQueueSetCreate(task13, 0x2);
+
+  unit_try(NULL != task14);
+
+  unit_try(RETURN_SUCCESS == xQueueSetAdd(task14, task15));
+
+  xTaskWait(task13);
+
+  unit_try(RETURN_SUCCESS == xQueueSend(task15, 0x7, (Char_t *)"MESSAGE"));
+
+  xTaskStartScheduler();
+
+  unit_try(true == xQueueIsQueueEmpty(task15));
+
+  xTaskDelete(task13);
+
+  xQueueSetDelete(task14);
+
+  xQueueDelete(task15);
+
+  unit_end();
+
+
+
+
+  unit_begin("xTaskWaitOn()");
+
+  xTaskResumeAll();
+
+  task15 = xQueueCreate(0x5);
+
+  task17 = xStreamCreate();
+
+  task18 = xTimerCreate(0x3E8);
+
+  task13 = xTaskCreate((Char_t *)"TASK13", task_harness_task4, task15);
+
+  task16 = xTaskCreate((Char_t *)"TASK16", task_harness_task4, task15);
+
+  unit_try(RETURN_SUCCESS == xTaskWaitOn(task13, TaskWaitConditionQueueNotEmpty, task15, zero));
+
+  unit_try(TaskStateWaiting == xTaskGetTaskState(task13));
+
+  unit_try(false == task13->waitReady);
+
+  unit_try(RETURN_FAILURE == xTaskWaitOn(task16, TaskWaitConditionQueueNotEmpty, task15, zero));
+
+  unit_try(RETURN_SUCCESS == xQueueSend(task15, 0x7, (Char_t *)"MESSAGE"));
+
+  unit_try(true == task13->waitReady);
+
+  xQueueDropMessage(task15);
+
+  unit_try(false == task13->waitReady);
+
+  unit_try(RETURN_SUCCESS == xTaskWaitOn(task16, TaskWaitConditionStreamBytes, task17, 0x3));
+
+  unit_try(RETURN_SUCCESS == xStreamSend(task17, 0x1));
+
+  unit_try(RETURN_SUCCESS == xStreamSend(task17, 0x2));
+
+  unit_try(false == task16->waitReady);
+
+  unit_try(RETURN_SUCCESS == xStreamSend(task17, 0x3));
+
+  unit_try(true == task16->waitReady);
+
+  xStreamReset(task17);
+
+  unit_try(false == task16->waitReady);
+
+  unit_try(RETURN_SUCCESS == xTaskWaitOn(task16, TaskWaitConditionTimerExpired, task18, zero));
+
+  unit_try(NULL == task17->waiter);
+
+  xTimerDelete(task18);
+
+  unit_try(TaskWaitConditionNone == task16->waitCondition);
+
+  xStreamDelete(task17);
+
+  xTaskDelete(task16);
+
+  unit_end();
+
+
+
+  unit_begin("Unit test for task wait on queue event");
+
+  unit_try(RETURN_SUCCESS == xQueueSend(task15, 0x7, (Char_t *)"MESSAGE"));
+
+  xTaskStartScheduler();
+
+  unit_try(true == xQueueIsQueueEmpty(task15));
+
+  unit_try(false == task13->waitReady);
+
+  xQueueDelete(task15);
+
+  unit_try(TaskWaitConditionNone == task13->waitCondition);
+
+  xTaskDelete(task13);
+
+  unit_end();
+
+
+
+
   unit_begin("Unit test for task watchdog timer");
 
   xTaskResumeAll();
@@ -421,6 +547,31 @@ void task_harness_task(Task_t *task_, TaskParm_t *parm_) {
   return;
 }
 
+void task_harness_task3(Task_t *task_, TaskParm_t *parm_) {
+
+  Queue_t *queue = NULL;
+
+  queue = xQueueSetSelect(task_->queueSet);
+
+  if (NULL != queue) {
+
+    xQueueDropMessage(queue);
+  }
+
+  xTaskSuspendAll();
+
+  return;
+}
+
+void task_harness_task4(Task_t *task_, TaskParm_t *parm_) {
+
+  xQueueDropMessage((Queue_t *)parm_);
+
+  xTaskSuspendAll();
+
+  return;
+}
+
 void task_harness_task2(Task_t *task_, TaskParm_t *parm_) {
 
   sleep(3);
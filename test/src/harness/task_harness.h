@@ -47,6 +47,8 @@ extern "C" {
 void task_harness(void);
 void task_harness_task(Task_t* task_, TaskParm_t* parm_);
 void task_harness_task2(Task_t* task_, TaskParm_t* parm_);
+void task_harness_task3(Task_t* task_, TaskParm_t* parm_);
+void task_harness_task4(Task_t* task_, TaskParm_t* parm_);
 
 #ifdef __cplusplus
 }
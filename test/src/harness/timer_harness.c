@@ -28,10 +28,31 @@
 #include "timer_harness.h"
 
 
+static Base_t expiries = zero;
+
+
 void timer_harness(void) {
 
   Timer_t* timer01 = NULL;
 
+  Timer_t* timer02 = NULL;
+
+  Timer_t* timer03 = NULL;
+
+  Timer_t* timer04 = NULL;
+
+  Timer_t* timer05 = NULL;
+
+  Task_t* task01 = NULL;
+
+  Queue_t* queue01 = NULL;
+
+  QueueMessage_t message01;
+
+  Base_t fired01 = zero;
+
+  Base_t fired02 = zero;
+
   unit_begin("xTimerCreate()");
 
   timer01 = NULL;
@@ -124,5 +145,285 @@ void timer_harness(void) {
 
   unit_end();
 
+
+
+  unit_begin("xTimerStart() not a timer");
+
+  queue01 = xQueueCreate(0x5);
+
+  unit_try(NULL != queue01);
+
+  unit_try(RETURN_SUCCESS == xQueueSend(queue01, 0x8, (Char_t *)"MESSAGE1"));
+
+  xTimerStart((Timer_t *)queue01);
+
+  xTimerChangePeriod((Timer_t *)queue01, 0x10);
+
+  unit_try(0x0u == xTimerGetPeriod((Timer_t *)queue01));
+
+  unit_try(false == xTimerIsTimerActive((Timer_t *)queue01));
+
+  unit_try(0x1u == xQueueGetLength(queue01));
+
+  unit_try(RETURN_SUCCESS == xQueueReceiveInto(queue01, &message01));
+
+  unit_try(0x0u == strncmp("MESSAGE1", (char *)message01.messageValue, 0x8));
+
+  xQueueDelete(queue01);
+
+  unit_end();
+
+
+
+  unit_begin("xTimerGetNextExpired()");
+
+  timer02 = xTimerCreate(0x64);
+
+  timer03 = xTimerCreate(0x32);
+
+  timer04 = xTimerCreate(0x14);
+
+  timer05 = xTimerCreate(0x11170);
+
+  xTimerStart(timer02);
+
+  xTimerStart(timer03);
+
+  xTimerStart(timer04);
+
+  xTimerStart(timer05);
+
+  xTimerStop(timer04);
+
+  unit_try(NULL == xTimerGetNextExpired());
+
+  sleep(1);
+
+  unit_try(timer03 == xTimerGetNextExpired());
+
+  unit_try(timer02 == xTimerGetNextExpired());
+
+  unit_try(NULL == xTimerGetNextExpired());
+
+  unit_try(true == xTimerHasTimerExpired(timer02));
+
+  xTimerReset(timer03);
+
+  unit_try(NULL == xTimerGetNextExpired());
+
+  sleep(1);
+
+  unit_try(timer03 == xTimerGetNextExpired());
+
+  unit_try(NULL == xTimerGetNextExpired());
+
+  xTimerDelete(timer02);
+
+  xTimerDelete(timer03);
+
+  xTimerDelete(timer04);
+
+  xTimerDelete(timer05);
+
+  unit_end();
+
+
+
+  unit_begin("xTimerCreateCallback()");
+
+  unit_try(NULL == xTimerCreateCallback(0x32, false, NULL, NULL));
+
+  timer02 = xTimerCreateCallback(0x32, false, timer_harness_callback, &fired01);
+
+  timer03 = xTimerCreateCallback(0x14, true, timer_harness_callback, &fired02);
+
+  unit_try(NULL != timer02);
+
+  unit_try(NULL != timer03);
+
+  unit_try(false == xTimerIsTimerActive(timer02));
+
+  task01 = xTaskCreate((Char_t *)"TIMER1", timer_harness_task, NULL);
+
+  unit_try(NULL != task01);
+
+  xTimerStart(timer02);
+
+  xTimerStart(timer03);
+
+  xTaskResumeAll();
+
+  xTaskStartScheduler();
+
+  unit_try(0x3u == fired01);
+
+  unit_try(0x1u == fired02);
+
+  unit_try(true == xTimerIsTimerActive(timer02));
+
+  unit_try(false == xTimerIsTimerActive(timer03));
+
+  unit_try(NULL == xTimerGetNextExpired());
+
+  xTimerDelete(timer02);
+
+  xTimerDelete(timer03);
+
+  xTaskDelete(task01);
+
+  unit_end();
+
+
+
+  unit_begin("xTimerCreateCallback() late scheduler");
+
+  fired01 = zero;
+
+  fired02 = zero;
+
+  expiries = zero;
+
+  timer02 = xTimerCreateCallback(0xF, true, timer_harness_order, &fired02);
+
+  timer03 = xTimerCreateCallback(0xE, true, timer_harness_order, &fired01);
+
+  task01 = xTaskCreate((Char_t *)"TIMER1", timer_harness_task, NULL);
+
+  unit_try(NULL != task01);
+
+
+  /* Start the timers off a boundary of the lowest wheel level so the later timer
+     sits one level above the earlier timer and is moved down first. */
+  while (zero == (__SysGetSysTicks__() & 0xFu)) {
+    /* Wait for the next tick. */
+  }
+
+  unit_try(NULL == xTimerGetNextExpired());
+
+  xTimerStart(timer02);
+
+  xTimerStart(timer03);
+
+
+  /* Start the scheduler long after both timers have expired. */
+  sleep(1);
+
+  xTaskResumeAll();
+
+  xTaskStartScheduler();
+
+  unit_try(0x1u == fired01);
+
+  unit_try(0x2u == fired02);
+
+  xTimerDelete(timer02);
+
+  xTimerDelete(timer03);
+
+  xTaskDelete(task01);
+
+  unit_end();
+
+
+
+  unit_begin("xTimerCreateCallback() stop due timer");
+
+  fired02 = zero;
+
+  expiries = zero;
+
+  timer03 = xTimerCreateCallback(0x14, true, timer_harness_callback, &fired02);
+
+  timer02 = xTimerCreateCallback(0xA, false, timer_harness_stop, timer03);
+
+  task01 = xTaskCreate((Char_t *)"TIMER1", timer_harness_task, NULL);
+
+  unit_try(NULL != task01);
+
+  xTimerStart(timer02);
+
+  xTimerStart(timer03);
+
+
+  /* Start the scheduler after both timers have expired so both are due in
+     the same pass. */
+  sleep(1);
+
+  xTaskResumeAll();
+
+  xTaskStartScheduler();
+
+  unit_try(true == xTimerIsTimerActive(timer02));
+
+  unit_try(false == xTimerIsTimerActive(timer03));
+
+  unit_try(0x1u == expiries);
+
+  unit_try(0x0u == fired02);
+
+  xTimerDelete(timer02);
+
+  xTimerDelete(timer03);
+
+  xTaskDelete(task01);
+
+  unit_end();
+
+  return;
+}
+
+
+
+void timer_harness_task(Task_t *task_, TaskParm_t *parm_) {
+
+  return;
+}
+
+
+
+void timer_harness_callback(Timer_t *timer_, TimerParm_t *parm_) {
+
+  Base_t *fired = (Base_t *)parm_;
+
+  (*fired)++;
+
+
+  /* The auto-reload timer stops the scheduler after it has expired three times. */
+  if ((0x3u == *fired) && (false == timer_->oneShot)) {
+
+    xTaskSuspendAll();
+  }
+
+  return;
+}
+
+
+
+void timer_harness_order(Timer_t *timer_, TimerParm_t *parm_) {
+
+  expiries++;
+
+  *((Base_t *)parm_) = expiries;
+
+
+  /* Stop the scheduler once both timers have expired. */
+  if (0x2u == expiries) {
+
+    xTaskSuspendAll();
+  }
+
+  return;
+}
+
+
+
+void timer_harness_stop(Timer_t *timer_, TimerParm_t *parm_) {
+
+  expiries++;
+
+  xTimerStop((Timer_t *)parm_);
+
+  xTaskSuspendAll();
+
   return;
 }
@@ -45,6 +45,10 @@ extern "C" {
 #endif
 
 void timer_harness(void);
+void timer_harness_task(Task_t *task_, TaskParm_t *parm_);
+void timer_harness_callback(Timer_t *timer_, TimerParm_t *parm_);
+void timer_harness_order(Timer_t *timer_, TimerParm_t *parm_);
+void timer_harness_stop(Timer_t *timer_, TimerParm_t *parm_);
 
 #ifdef __cplusplus
 }
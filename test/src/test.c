@@ -76,6 +76,7 @@ void reset(void) {
   __TaskStateClear__();
   __TimerStateClear__();
   __DeviceStateClear__();
+  __StreamStateClear__();
 
   return;
 }